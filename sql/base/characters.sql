@@ -21,7 +21,7 @@
 
 DROP TABLE IF EXISTS `character_db_version`;
 CREATE TABLE `character_db_version` (
-  `required_c0001_01_characters_account_instances_entered` bit(1) DEFAULT NULL
+  `required_c0001_02_characters_update_fields_blob` bit(1) DEFAULT NULL
 ) ENGINE=MyISAM DEFAULT CHARSET=utf8 ROW_FORMAT=DYNAMIC COMMENT='Last applied sql update to DB';
 
 --
@@ -1091,9 +1091,9 @@ CREATE TABLE `characters` (
   `power5` int(10) unsigned NOT NULL DEFAULT '0',
   `specCount` tinyint(3) unsigned NOT NULL DEFAULT '1',
   `activeSpec` tinyint(3) unsigned NOT NULL DEFAULT '0',
-  `exploredZones` longtext,
+  `exploredZones` blob,
   `equipmentCache` longtext,
-  `knownTitles` longtext,
+  `knownTitles` blob,
   `actionBars` tinyint(3) unsigned NOT NULL DEFAULT '0',
   `slot` tinyint(3) unsigned NOT NULL DEFAULT '255',
   `deleteInfos_Account` int(11) unsigned DEFAULT NULL,
@@ -1586,7 +1586,7 @@ DROP TABLE IF EXISTS `item_instance`;
 CREATE TABLE `item_instance` (
   `guid` int(11) unsigned NOT NULL DEFAULT '0',
   `owner_guid` int(11) unsigned NOT NULL DEFAULT '0',
-  `data` longtext,
+  `data` blob,
   `text` longtext,
   PRIMARY KEY (`guid`),
   KEY `idx_owner_guid` (`owner_guid`)
@@ -0,0 +1,7 @@
+ALTER TABLE character_db_version CHANGE COLUMN required_c0001_01_characters_account_instances_entered required_c0001_02_characters_update_fields_blob bit;
+
+ALTER TABLE item_instance MODIFY COLUMN data blob;
+ALTER TABLE characters MODIFY COLUMN exploredZones blob, MODIFY COLUMN knownTitles blob;
+
+-- existing text rows are still loaded, this converts them to the binary format at next world server start
+UPDATE saved_variables SET cleaning_flags = cleaning_flags | 0x10;
@@ -0,0 +1,5 @@
+ALTER TABLE db_version CHANGE COLUMN required_c0003_02_mangos_quest_data required_c0004_01_mangos_command bit;
+
+DELETE FROM command WHERE name IN ('debug memory');
+INSERT INTO command (name, security, help) VALUES
+('debug memory',3,'Syntax: .debug memory\r\n\r\nShow estimated memory used by creatures, pets, gameobjects and dynamic objects per map and the object pool usage.');
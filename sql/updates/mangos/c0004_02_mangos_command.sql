@@ -0,0 +1,5 @@
+ALTER TABLE db_version CHANGE COLUMN required_c0004_01_mangos_command required_c0004_02_mangos_command bit;
+
+DELETE FROM command WHERE name IN ('debug grids');
+INSERT INTO command (name, security, help) VALUES
+('debug grids',3,'Syntax: .debug grids\r\n\r\nShow loaded and unloading grid counts per map with grid load and unload durations.');
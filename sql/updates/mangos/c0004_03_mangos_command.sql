@@ -0,0 +1,5 @@
+ALTER TABLE db_version CHANGE COLUMN required_c0004_02_mangos_command required_c0004_03_mangos_command bit;
+
+DELETE FROM command WHERE name IN ('debug dblatency');
+INSERT INTO command (name, security, help) VALUES
+('debug dblatency',3,'Syntax: .debug dblatency\r\n\r\nShow how long async database results waited before their callbacks ran, per database.');
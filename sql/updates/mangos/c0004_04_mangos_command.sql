@@ -0,0 +1,5 @@
+ALTER TABLE db_version CHANGE COLUMN required_c0004_03_mangos_command required_c0004_04_mangos_command bit;
+
+DELETE FROM command WHERE name IN ('debug dbtransactions');
+INSERT INTO command (name, security, help) VALUES
+('debug dbtransactions',3,'Syntax: .debug dbtransactions\r\n\r\nShow executed transactions per database with their statement count and the number of round trips after merging INSERTs.');
@@ -33,16 +33,18 @@ class GridInfo
     public:
 
         GridInfo()
-            : i_timer(0), i_unloadActiveLockCount(0), i_unloadExplicitLock(false)
+            : i_expiryTicket(0), i_unloadActiveLockCount(0), i_unloadExplicitLock(false)
         {
         }
 
-        GridInfo(time_t expiry, bool unload = true)
-            : i_timer(expiry), i_unloadActiveLockCount(0), i_unloadExplicitLock(!unload)
+        GridInfo(bool unload)
+            : i_expiryTicket(0), i_unloadActiveLockCount(0), i_unloadExplicitLock(!unload)
         {
         }
 
-        const TimeTracker& getTimeTracker() const { return i_timer; }
+        // ticket of the last scheduled expiry, older queued expiries of the grid are ignored
+        uint32 getExpiryTicket() const { return i_expiryTicket; }
+        void setExpiryTicket(uint32 ticket) { i_expiryTicket = ticket; }
 
         bool getUnloadLock() const
         {
@@ -53,13 +55,9 @@ class GridInfo
         void incUnloadActiveLock() { ++i_unloadActiveLockCount; }
         void decUnloadActiveLock() { if (i_unloadActiveLockCount) --i_unloadActiveLockCount; }
 
-        void setTimer(const TimeTracker& pTimer) { i_timer = pTimer; }
-        void ResetTimeTracker(time_t interval) { i_timer.Reset(interval); }
-        void UpdateTimeTracker(time_t diff) { i_timer.Update(diff); }
-
     private:
 
-        TimeTracker i_timer;
+        uint32 i_expiryTicket;
         uint16 i_unloadActiveLockCount : 16;                // lock from active object spawn points (prevent clone loading)
         bool i_unloadExplicitLock      : 1;                 // explicit manual lock or config setting
 };
@@ -86,10 +84,10 @@ class NGrid
 
         typedef Grid<ACTIVE_OBJECT, WORLD_OBJECT_TYPES, GRID_OBJECT_TYPES> GridType;
 
-        NGrid(uint32 id, uint32 x, uint32 y, time_t expiry, bool unload = true)
-            : i_gridId(id), i_x(x), i_y(y), i_cellstate(GRID_STATE_INVALID), i_GridObjectDataLoaded(false)
+        NGrid(uint32 id, uint32 x, uint32 y, bool unload = true)
+            : i_gridId(id), i_x(x), i_y(y), i_cellstate(GRID_STATE_INVALID), i_GridObjectDataLoaded(false), i_unloadInProgress(false)
         {
-            i_GridInfo = GridInfo(expiry, unload);
+            i_GridInfo = GridInfo(unload);
         }
 
         const GridType& operator()(uint32 x, uint32 y) const
@@ -119,15 +117,14 @@ class NGrid
 
         bool isGridObjectDataLoaded() const { return i_GridObjectDataLoaded; }
         void setGridObjectDataLoaded(bool pLoaded) { i_GridObjectDataLoaded = pLoaded; }
+        bool isUnloadInProgress() const { return i_unloadInProgress; }
+        void setUnloadInProgress(bool on) { i_unloadInProgress = on; }
 
         GridInfo* getGridInfoRef() { return &i_GridInfo; }
-        const TimeTracker& getTimeTracker() const { return i_GridInfo.getTimeTracker(); }
         bool getUnloadLock() const { return i_GridInfo.getUnloadLock(); }
         void setUnloadExplicitLock(bool on) { i_GridInfo.setUnloadExplicitLock(on); }
         void incUnloadActiveLock() { i_GridInfo.incUnloadActiveLock(); }
         void decUnloadActiveLock() { i_GridInfo.decUnloadActiveLock(); }
-        void ResetTimeTracker(time_t interval) { i_GridInfo.ResetTimeTracker(interval); }
-        void UpdateTimeTracker(time_t diff) { i_GridInfo.UpdateTimeTracker(diff); }
 
         template<class SPECIFIC_OBJECT>
         void AddWorldObject(const uint32 x, const uint32 y, SPECIFIC_OBJECT* obj)
@@ -194,6 +191,7 @@ class NGrid
         grid_state_t i_cellstate;
         GridType i_cells[N][N];
         bool i_GridObjectDataLoaded;
+        bool i_unloadInProgress;                            // objects are being unloaded over several map updates
 };
 
 #endif
@@ -72,6 +72,12 @@ class TypeUnorderedMapContainer
             return TypeUnorderedMapContainer::find(i_elements, hdl, (SPECIFIC_TYPE*)nullptr);
         }
 
+        template<class SPECIFIC_TYPE>
+        size_t size(SPECIFIC_TYPE* /*obj*/) const
+        {
+            return TypeUnorderedMapContainer::size(i_elements, (SPECIFIC_TYPE*)nullptr);
+        }
+
         template<class SPECIFIC_TYPE>
         typename std::unordered_map<KEY_TYPE, SPECIFIC_TYPE*>::iterator begin()
         {
@@ -151,6 +157,32 @@ class TypeUnorderedMapContainer
             return ret ? ret : TypeUnorderedMapContainer::find(elements._TailElements, hdl, (SPECIFIC_TYPE*)nullptr);
         }
 
+        // Size helpers
+        template<class SPECIFIC_TYPE>
+        static size_t size(ContainerUnorderedMap<SPECIFIC_TYPE, KEY_TYPE> const& elements, SPECIFIC_TYPE* /*obj*/)
+        {
+            return elements._element.size();
+        }
+
+        template<class SPECIFIC_TYPE>
+        static size_t size(ContainerUnorderedMap<TypeNull, KEY_TYPE> const& /*elements*/, SPECIFIC_TYPE* /*obj*/)
+        {
+            return 0;
+        }
+
+        template<class SPECIFIC_TYPE, class T>
+        static size_t size(ContainerUnorderedMap<T, KEY_TYPE> const& /*elements*/, SPECIFIC_TYPE* /*obj*/)
+        {
+            return 0;
+        }
+
+        template<class SPECIFIC_TYPE, class H, class T>
+        static size_t size(ContainerUnorderedMap< TypeList<H, T>, KEY_TYPE > const& elements, SPECIFIC_TYPE* /*obj*/)
+        {
+            return TypeUnorderedMapContainer::size(elements._elements, (SPECIFIC_TYPE*)nullptr) +
+                   TypeUnorderedMapContainer::size(elements._TailElements, (SPECIFIC_TYPE*)nullptr);
+        }
+
         // Erase helpers
         template<class SPECIFIC_TYPE>
         static bool erase(ContainerUnorderedMap<SPECIFIC_TYPE, KEY_TYPE>& elements, KEY_TYPE handle, SPECIFIC_TYPE* /*obj*/)
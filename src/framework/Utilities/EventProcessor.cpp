@@ -18,10 +18,95 @@
 
 #include "EventProcessor.h"
 
+#include <algorithm>
+#include <new>
+
+//== BasicEvent pooled allocation ======================
+
+namespace
+{
+    // size classes of EVENT_POOL_GRANULARITY bytes, bigger events use the global allocator
+    size_t const EVENT_POOL_GRANULARITY   = 16;
+    size_t const EVENT_POOL_MAX_SIZE      = 256;
+    size_t const EVENT_POOL_SIZE_CLASSES  = EVENT_POOL_MAX_SIZE / EVENT_POOL_GRANULARITY;
+    // freed events kept per size class, further ones go back to the global allocator,
+    // so a spike of events doesn't pin its peak memory in every map thread
+    size_t const EVENT_POOL_MAX_FREE      = 256;
+
+    // Free lists are per thread so no locking is needed. Memory is handed back to the free list of the
+    // deleting thread, and is reused by the next events of that size.
+    struct EventPool
+    {
+        void* freeList[EVENT_POOL_SIZE_CLASSES] = {};
+        size_t freeCount[EVENT_POOL_SIZE_CLASSES] = {};
+
+        ~EventPool();
+    };
+
+    // events deleted after the pool at thread exit are not recycled
+    thread_local bool eventPoolDestroyed = false;
+    thread_local EventPool eventPool;
+
+    EventPool::~EventPool()
+    {
+        eventPoolDestroyed = true;
+
+        for (void* head : freeList)
+        {
+            while (head)
+            {
+                void* next = *static_cast<void**>(head);
+                ::operator delete(head);
+                head = next;
+            }
+        }
+    }
+}
+
+void* BasicEvent::operator new(size_t size)
+{
+    if (size > EVENT_POOL_MAX_SIZE)
+        return ::operator new(size);
+
+    // always the full class size, the memory may be recycled for any event of the class
+    size_t sizeClass = (size - 1) / EVENT_POOL_GRANULARITY;
+    if (eventPoolDestroyed || !eventPool.freeList[sizeClass])
+        return ::operator new((sizeClass + 1) * EVENT_POOL_GRANULARITY);
+
+    void*& head = eventPool.freeList[sizeClass];
+    void* object = head;
+    head = *static_cast<void**>(object);
+    --eventPool.freeCount[sizeClass];
+    return object;
+}
+
+void BasicEvent::operator delete(void* ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+    size_t sizeClass = (size - 1) / EVENT_POOL_GRANULARITY;
+    if (size > EVENT_POOL_MAX_SIZE || eventPoolDestroyed || eventPool.freeCount[sizeClass] >= EVENT_POOL_MAX_FREE)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    void*& head = eventPool.freeList[sizeClass];
+    *static_cast<void**>(ptr) = head;
+    head = ptr;
+    ++eventPool.freeCount[sizeClass];
+}
+
+//== EventProcessor ====================================
+
 EventProcessor::EventProcessor()
 {
     m_time = 0;
+    m_currentSlotTick = 0;
+    m_nextSequence = 0;
     m_aborting = false;
+    m_updating = false;
 }
 
 EventProcessor::~EventProcessor()
@@ -34,13 +119,36 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
+    // collect due events of all slots passed since last update (including the last one, it can hold later events of its tick)
+    uint64 nowTick = m_time / EVENT_WHEEL_SLOT_TIME;
+    if (m_wheel)
+    {
+        uint64 slotCount = std::min<uint64>(nowTick - m_currentSlotTick + 1, EVENT_WHEEL_SLOTS);
+        for (uint64 i = 0; i < slotCount; ++i)
+        {
+            LinkedListHead& slot = m_wheel[(m_currentSlotTick + i) % EVENT_WHEEL_SLOTS];
+            for (LinkedListElement* elem = slot.getFirst(); elem;)
+            {
+                BasicEvent* Event = ToEvent(elem);
+                elem = elem->next();
+
+                if (Event->m_execTime <= m_time)
+                {
+                    Event->delink();
+                    InsertDueEvent(Event);
+                }
+            }
+        }
+    }
+    m_currentSlotTick = nowTick;
+
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    m_updating = true;
+    while (LinkedListElement* elem = m_dueEvents.getFirst())
     {
         // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
+        BasicEvent* Event = ToEvent(elem);
+        Event->delink();
 
         if (!Event->to_Abort)
         {
@@ -56,6 +164,21 @@ void EventProcessor::Update(uint32 p_time)
             delete Event;
         }
     }
+    m_updating = false;
+}
+
+void EventProcessor::AbortEventsIn(LinkedListHead& list, bool force)
+{
+    for (LinkedListElement* elem = list.getFirst(); elem;)
+    {
+        BasicEvent* Event = ToEvent(elem);
+        elem = elem->next();
+
+        Event->to_Abort = true;
+        Event->Abort(m_time);
+        if (force || Event->IsDeletable())
+            delete Event;                                   // delinks itself
+    }
 }
 
 void EventProcessor::KillAllEvents(bool force)
@@ -63,39 +186,19 @@ void EventProcessor::KillAllEvents(bool force)
     // prevent event insertions
     m_aborting = true;
 
-    // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
-    {
-        EventList::iterator i_old = i;
-        ++i;
-
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
-        {
-            delete i_old->second;
+    // abort all existing events, not deletable ones stay queued (in non force case) and get deleted at their execution time
+    if (m_wheel)
+        for (uint32 i = 0; i < EVENT_WHEEL_SLOTS; ++i)
+            AbortEventsIn(m_wheel[i], force);
 
-            if (!force)                                     // need per-element cleanup
-                m_events.erase(i_old);
-        }
-    }
-
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
+    AbortEventsIn(m_dueEvents, force);
 }
 
 void EventProcessor::KillEvent(BasicEvent* event)
 {
-    for (EventList::iterator iter = m_events.begin(); iter != m_events.end();)
-    {
-        if (iter->second == event)
-        {
-            delete iter->second;
-            iter = m_events.erase(iter);
-        }
-        else ++iter;
-    }
+    // only queued events, an event being executed right now is not in a list
+    if (event->isInList())
+        delete event;                                       // delinks itself
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
@@ -104,24 +207,58 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
 
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    Event->m_sequence = m_nextSequence++;
+    ScheduleEvent(Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* Event, uint64 msTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != Event)
-            continue;
+    if (!Event->isInList())
+        return;
 
-        Event->m_execTime = msTime;
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(msTime, Event));
-        break;
-    }
+    Event->delink();
+    Event->m_execTime = msTime;
+    Event->m_sequence = m_nextSequence++;
+    ScheduleEvent(Event);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
 {
     return m_time + t_offset;
 }
+
+void EventProcessor::ScheduleEvent(BasicEvent* Event)
+{
+    // already due events added while updating are executed in the same update, as before
+    if (m_updating && Event->m_execTime <= m_time)
+    {
+        InsertDueEvent(Event);
+        return;
+    }
+
+    if (!m_wheel)
+        m_wheel.reset(new LinkedListHead[EVENT_WHEEL_SLOTS]);
+
+    // past times go to the current slot, it is walked first at next update
+    uint64 tick = std::max(Event->m_execTime / EVENT_WHEEL_SLOT_TIME, m_currentSlotTick);
+    m_wheel[tick % EVENT_WHEEL_SLOTS].insertLast(Event);
+}
+
+void EventProcessor::InsertDueEvent(BasicEvent* Event)
+{
+    // due lists are short, keep them ordered by (m_execTime, m_sequence) with a backward scan
+    LinkedListElement* elem = m_dueEvents.getLast();
+    while (elem)
+    {
+        BasicEvent const* other = ToEvent(elem);
+        if (other->m_execTime < Event->m_execTime || (other->m_execTime == Event->m_execTime && other->m_sequence < Event->m_sequence))
+            break;
+
+        elem = elem->prev();
+    }
+
+    if (elem)
+        elem->insertAfter(Event);
+    else
+        m_dueEvents.insertFirst(Event);
+}
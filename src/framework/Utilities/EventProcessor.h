@@ -20,17 +20,21 @@
 #define __EVENTPROCESSOR_H
 
 #include "Platform/Define.h"
+#include "Utilities/LinkedList.h"
 
-#include <map>
+#include <cstddef>
+#include <memory>
 
 // Note. All times are in milliseconds here.
 
-class BasicEvent
+class BasicEvent : private LinkedListElement
 {
+        friend class EventProcessor;
+
     public:
 
         BasicEvent()
-            : to_Abort(false)
+            : to_Abort(false), m_sequence(0)
         {
         }
 
@@ -38,6 +42,10 @@ class BasicEvent
         {
         };
 
+        // events are allocated from per thread size class pools, see EventProcessor.cpp
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         // this method executes when the event is triggered
         // return false if event does not want to be deleted
         // e_time is execution time, p_time is update interval
@@ -53,9 +61,16 @@ class BasicEvent
         // these can be used for time offset control
         uint64 m_addTime;                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
+
+    private:
+        uint64 m_sequence;                                  // insertion order, keeps events with same m_execTime in FIFO order
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// Events are kept in a hashed timing wheel: slot = (m_execTime / EVENT_WHEEL_SLOT_TIME) % EVENT_WHEEL_SLOTS.
+// A slot holds events of all rounds, each update only walks the slots passed since the previous update
+// and picks the events that are due, so insert, modify and kill are O(1) list operations.
+#define EVENT_WHEEL_SLOTS       32
+#define EVENT_WHEEL_SLOT_TIME   128
 
 class EventProcessor
 {
@@ -70,13 +85,22 @@ class EventProcessor
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true);
         void ModifyEventTime(BasicEvent* event, uint64 msTime);
         uint64 CalculateTime(uint64 t_offset) const;
-        EventList& GetEvents() { return m_events; }
 
     protected:
 
+        void ScheduleEvent(BasicEvent* event);
+        void InsertDueEvent(BasicEvent* event);
+        void AbortEventsIn(LinkedListHead& list, bool force);
+
+        static BasicEvent* ToEvent(LinkedListElement* elem) { return static_cast<BasicEvent*>(elem); }
+
         uint64 m_time;
-        EventList m_events;
+        uint64 m_currentSlotTick;                           // m_time / EVENT_WHEEL_SLOT_TIME at last update, first slot to walk
+        uint64 m_nextSequence;
+        std::unique_ptr<LinkedListHead[]> m_wheel;          // allocated at first event, most processors never get one
+        LinkedListHead m_dueEvents;                         // events due in the running update, ordered by (m_execTime, m_sequence)
         bool m_aborting;
+        bool m_updating;
 };
 
 #endif
@@ -20,6 +20,7 @@
 #define _LINKEDLIST
 
 #include <cstddef>
+#include <iterator>
 
 //============================================
 class LinkedListHead;
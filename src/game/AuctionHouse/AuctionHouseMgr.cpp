@@ -561,47 +561,67 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(Unit* unit)
     return sAuctionHouseStore.LookupEntry(houseid);
 }
 
+// Auctions handled per auction house and Update() call, the rest waits for the next call
+#define AUCTION_UPDATE_BATCH_SIZE 2000
+
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld.GetGameTime();
-    ///- Handle expired auctions
-    for (AuctionEntryMap::iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end();)
+
+    std::vector<uint32> removed;
+    uint32 processed = 0;
+
+    ///- Handle expired auctions, in update time order
+    while (!m_updateQueue.empty() && m_updateQueue.top().first < curTime && processed < AUCTION_UPDATE_BATCH_SIZE)
     {
-        if (itr->second->moneyDeliveryTime)                 // pending auction
+        AuctionUpdate update = m_updateQueue.top();
+        m_updateQueue.pop();
+
+        AuctionEntryMap::iterator itr = AuctionsMap.find(update.second);
+        if (itr == AuctionsMap.end())                       // removed meanwhile
+            continue;
+
+        AuctionEntry* auction = itr->second;
+        if (auction->GetUpdateTime() != update.first)       // rescheduled, a later queue entry handles it
+            continue;
+
+        ++processed;
+
+        if (auction->moneyDeliveryTime)                     // pending auction
         {
-            if (curTime > itr->second->moneyDeliveryTime)
-            {
-                sAuctionMgr.SendAuctionSuccessfulMail(itr->second);
+            sAuctionMgr.SendAuctionSuccessfulMail(auction);
 
-                itr->second->DeleteFromDB();
-                MANGOS_ASSERT(!itr->second->itemGuidLow);   // already removed or send in mail at won
-                delete itr->second;
-                AuctionsMap.erase(itr++);
-                continue;
-            }
+            MANGOS_ASSERT(!auction->itemGuidLow);           // already removed or send in mail at won
         }
         else                                                // active auction
         {
-            if (curTime > itr->second->expireTime)
+            ///- perform the transaction if there was bidder
+            if (auction->bid)
             {
-                ///- perform the transaction if there was bidder
-                if (itr->second->bid)
-                    itr->second->AuctionBidWinning();
-                ///- cancel the auction if there was no bidder and clear the auction
-                else
-                {
-                    sAuctionMgr.SendAuctionExpiredMail(itr->second);
-
-                    itr->second->DeleteFromDB();
-                    delete itr->second;
-                    AuctionsMap.erase(itr++);
-                    continue;
-                }
+                auction->AuctionBidWinning();               // becomes pending, queued again for money delivery
+                continue;
             }
+
+            ///- cancel the auction if there was no bidder and clear the auction
+            sAuctionMgr.SendAuctionExpiredMail(auction);
         }
 
-        ++itr;
+        removed.push_back(auction->Id);
+        delete auction;
+        AuctionsMap.erase(itr);
     }
+
+    if (removed.empty())
+        return;
+
+    // one statement for all removed auctions instead of AuctionEntry::DeleteFromDB() for each
+    std::ostringstream ss;
+    ss << "DELETE FROM auction WHERE id IN (";
+    for (size_t i = 0; i < removed.size(); ++i)
+        ss << (i ? "," : "") << removed[i];
+    ss << ")";
+
+    CharacterDatabase.Execute(ss.str().c_str());
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
@@ -994,6 +1014,7 @@ void AuctionEntry::SaveToDB() const
 void AuctionEntry::AuctionBidWinning(Player* newbidder)
 {
     moneyDeliveryTime = time(nullptr) + HOUR;
+    sAuctionMgr.GetAuctionsMap(auctionHouseEntry)->ScheduleUpdate(this);
 
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("UPDATE auction SET itemguid = 0, moneyTime = '" UI64FMTD "', buyguid = '%u', lastbid = '" UI64FMTD "' WHERE id = '%u'", (uint64)moneyDeliveryTime, bidder, bid, Id);
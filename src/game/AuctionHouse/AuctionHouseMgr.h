@@ -22,6 +22,8 @@
 #include "Common.h"
 #include "Server/DBCStructure.h"
 
+#include <queue>
+
 class Item;
 class Player;
 class Unit;
@@ -78,6 +80,8 @@ struct AuctionEntry
     void DeleteFromDB() const;
     void SaveToDB() const;
     void AuctionBidWinning(Player* bidder = nullptr);
+    // time of the next AuctionHouseObject::Update action: money delivery of pending, or expire of active auctions
+    time_t GetUpdateTime() const { return moneyDeliveryTime ? moneyDeliveryTime : expireTime; }
 
     // -1,0,+1 order result
     int CompareAuctionEntry(uint32 column, const AuctionEntry* auc, Player* viewPlayer) const;
@@ -108,8 +112,12 @@ class AuctionHouseObject
         {
             MANGOS_ASSERT(ah);
             AuctionsMap[ah->Id] = ah;
+            ScheduleUpdate(ah);
         }
 
+        // must be called after every change of AuctionEntry::GetUpdateTime()
+        void ScheduleUpdate(AuctionEntry const* ah) { m_updateQueue.push(AuctionUpdate(ah->GetUpdateTime(), ah->Id)); }
+
         AuctionEntry* GetAuction(uint32 id) const
         {
             AuctionEntryMap::const_iterator itr = AuctionsMap.find(id);
@@ -130,6 +138,10 @@ class AuctionHouseObject
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint64 bid, uint64 buyout = 0, uint64 deposit = 0, Player* pl = nullptr);
     private:
         AuctionEntryMap AuctionsMap;
+
+        // auctions by update time, entries left from earlier update times are skipped when popped
+        typedef std::pair<time_t, uint32 /*auction id*/> AuctionUpdate;
+        std::priority_queue<AuctionUpdate, std::vector<AuctionUpdate>, std::greater<AuctionUpdate>> m_updateQueue;
 };
 
 class AuctionSorter
@@ -1768,13 +1768,19 @@ void AuctionHouseBot::Rebuild(bool all)
 {
     for (uint32 i = 0; i < MAX_AUCTION_HOUSE_TYPE; ++i)
     {
-        AuctionHouseObject::AuctionEntryMapBounds bounds = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i))->GetAuctionsBounds();
+        AuctionHouseObject* auctionHouse = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i));
+        AuctionHouseObject::AuctionEntryMapBounds bounds = auctionHouse->GetAuctionsBounds();
         for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
         {
             AuctionEntry* entry = itr->second;
             if (!entry->owner)                              // ahbot auction
+            {
                 if (all || entry->bid == 0)                 // expire now auction if no bid or forced
+                {
                     entry->expireTime = sWorld.GetGameTime();
+                    auctionHouse->ScheduleUpdate(entry);
+                }
+            }
         }
     }
 }
@@ -260,10 +260,14 @@ ChatCommand* ChatHandler::getCommandTable()
         { "anim",           SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugAnimCommand,                "", nullptr },
         { "arena",          SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugArenaCommand,               "", nullptr },
         { "bg",             SEC_ADMINISTRATOR,  false, nullptr,                                             "", bgCommandTable },
+        { "dblatency",      SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugDbLatencyCommand,           "", nullptr },
+        { "dbtransactions", SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugDbTransactionsCommand,      "", nullptr },
         { "getitemstate",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemStateCommand,        "", nullptr },
         { "lootrecipient",  SEC_GAMEMASTER,     false, &ChatHandler::HandleDebugGetLootRecipientCommand,    "", nullptr },
         { "getitemvalue",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetItemValueCommand,        "", nullptr },
         { "getvalue",       SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugGetValueCommand,            "", nullptr },
+        { "grids",          SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugGridsCommand,               "", nullptr },
+        { "memory",         SEC_ADMINISTRATOR,  true,  &ChatHandler::HandleDebugMemoryCommand,              "", nullptr },
         { "moditemvalue",   SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugModItemValueCommand,        "", nullptr },
         { "modvalue",       SEC_ADMINISTRATOR,  false, &ChatHandler::HandleDebugModValueCommand,            "", nullptr },
         { "play",           SEC_MODERATOR,      false, nullptr,                                                "", debugPlayCommandTable },
@@ -228,6 +228,10 @@ class ChatHandler
         bool HandleDebugGetItemValueCommand(char* args);
         bool HandleDebugGetLootRecipientCommand(char* args);
         bool HandleDebugGetValueCommand(char* args);
+        bool HandleDebugMemoryCommand(char* args);
+        bool HandleDebugGridsCommand(char* args);
+        bool HandleDebugDbLatencyCommand(char* args);
+        bool HandleDebugDbTransactionsCommand(char* args);
         bool HandleDebugModItemValueCommand(char* args);
         bool HandleDebugModValueCommand(char* args);
         bool HandleDebugSetAuraStateCommand(char* args);
@@ -37,6 +37,9 @@
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
 #endif
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+#include "PlayerBot/Base/PlayerbotAI.h"
+#endif
 
 bool WorldSession::processChatmessageFurtherAfterSecurityChecks(std::string& msg, uint32 lang)
 {
@@ -320,6 +323,12 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket& recv_data)
             WorldPacket data;
             ChatHandler::BuildChatPacket(data, ChatMsg(type), msg.c_str(), Language(lang), _player->GetChatTag(), _player->GetObjectGuid(), _player->GetName());
             group->BroadcastPacket(data, false, group->GetMemberGroup(GetPlayer()->GetObjectGuid()));
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+            PlayerbotEvent botEvent(BOT_EVENT_CHAT, _player->GetObjectGuid(), type);
+            botEvent.value2 = lang;
+            botEvent.text = msg;
+            group->BroadcastBotEvent(botEvent, false, group->GetMemberGroup(GetPlayer()->GetObjectGuid()));
+#endif
 
             break;
         }
@@ -425,6 +434,12 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket& recv_data)
             WorldPacket data;
             ChatHandler::BuildChatPacket(data, CHAT_MSG_RAID, msg.c_str(), Language(lang), _player->GetChatTag(), _player->GetObjectGuid(), _player->GetName());
             group->BroadcastPacket(data, false);
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+            PlayerbotEvent botEvent(BOT_EVENT_CHAT, _player->GetObjectGuid(), CHAT_MSG_RAID);
+            botEvent.value2 = lang;
+            botEvent.text = msg;
+            group->BroadcastBotEvent(botEvent, false);
+#endif
         } break;
         case CHAT_MSG_RAID_LEADER:
         {
@@ -462,6 +477,12 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket& recv_data)
             WorldPacket data;
             ChatHandler::BuildChatPacket(data, CHAT_MSG_RAID_LEADER, msg.c_str(), Language(lang), _player->GetChatTag(), _player->GetObjectGuid(), _player->GetName());
             group->BroadcastPacket(data, false);
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+            PlayerbotEvent botEvent(BOT_EVENT_CHAT, _player->GetObjectGuid(), CHAT_MSG_RAID_LEADER);
+            botEvent.value2 = lang;
+            botEvent.text = msg;
+            group->BroadcastBotEvent(botEvent, false);
+#endif
         } break;
 
         case CHAT_MSG_RAID_WARNING:
@@ -158,11 +158,10 @@ bool ChatHandler::HandleGMListIngameCommand(char* /*args*/)
     std::list< std::pair<std::string, bool> > names;
 
     {
-        HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-        HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-        for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+        HashMapHolder<Player>::SnapshotType players = sObjectAccessor.GetPlayersSnapshot();
+        for (HashMapHolder<Player>::SnapshotType::const_iterator itr = players.begin(); itr != players.end(); ++itr)
         {
-            Player* player = itr->second;
+            Player* player = *itr;
             AccountTypes security = player->GetSession()->GetSecurity();
             if ((player->IsGameMaster() || (security > SEC_PLAYER && security <= (AccountTypes)sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_IN_GM_LIST))) &&
                     (!m_session || player->IsVisibleGloballyFor(m_session->GetPlayer())))
@@ -48,6 +48,7 @@
 #include "Mails/Mail.h"
 #include "Util/Util.h"
 #include "Entities/ItemEnchantmentMgr.h"
+#include "Entities/QueryResponseCache.h"
 #include "BattleGround/BattleGroundMgr.h"
 #include "Maps/MapPersistentStateMgr.h"
 #include "Maps/InstanceData.h"
@@ -452,6 +453,8 @@ bool ChatHandler::HandleReloadHotfixDataCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading hotfix data...");
     sObjectMgr.LoadHotfixData();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_ITEM);
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_ITEM_SPARSE);
     SendGlobalSysMessage("DB table `hotfix_data` reloaded.");
     return true;
 }
@@ -505,6 +508,7 @@ bool ChatHandler::HandleReloadQuestTemplateCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Quest Templates...");
     sObjectMgr.LoadQuests();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_QUEST);
     SendGlobalSysMessage("DB table `quest_template` (quest definitions) reloaded.");
 
     /// dependent also from `gameobject` but this table not reloaded anyway
@@ -641,6 +645,7 @@ bool ChatHandler::HandleReloadNpcTextCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading `npc_text` Table!");
     sObjectMgr.LoadGossipText();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_NPC_TEXT);
     SendGlobalSysMessage("DB table `npc_text` reloaded.");
     return true;
 }
@@ -834,6 +839,7 @@ bool ChatHandler::HandleReloadPageTextsCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Page Texts...");
     sObjectMgr.LoadPageTexts();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_PAGE_TEXT);
     SendGlobalSysMessage("DB table `page_texts` reloaded.");
     return true;
 }
@@ -1097,6 +1103,7 @@ bool ChatHandler::HandleReloadLocalesCreatureCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Creature ...");
     sObjectMgr.LoadCreatureLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_CREATURE);
     SendGlobalSysMessage("DB table `locales_creature` reloaded.");
     return true;
 }
@@ -1105,6 +1112,7 @@ bool ChatHandler::HandleReloadLocalesGameobjectCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Gameobject ... ");
     sObjectMgr.LoadGameObjectLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_GAMEOBJECT);
     SendGlobalSysMessage("DB table `locales_gameobject` reloaded.");
     return true;
 }
@@ -1129,6 +1137,7 @@ bool ChatHandler::HandleReloadLocalesNpcTextCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales NPC Text ... ");
     sObjectMgr.LoadGossipTextLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_NPC_TEXT);
     SendGlobalSysMessage("DB table `locales_npc_text` reloaded.");
     return true;
 }
@@ -1137,6 +1146,7 @@ bool ChatHandler::HandleReloadLocalesPageTextCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Page Text ... ");
     sObjectMgr.LoadPageTextLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_PAGE_TEXT);
     SendGlobalSysMessage("DB table `locales_page_text` reloaded.");
     return true;
 }
@@ -1153,6 +1163,7 @@ bool ChatHandler::HandleReloadLocalesQuestCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Quest ... ");
     sObjectMgr.LoadQuestLocales();
+    sQueryResponseCache.Invalidate(QUERY_RESPONSE_QUEST);
     SendGlobalSysMessage("DB table `locales_quest` reloaded.");
     return true;
 }
@@ -5411,9 +5422,9 @@ bool ChatHandler::HandleResetAllCommand(char* args)
     }
 
     CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE (at_login & '%u') = '0'", atLogin, atLogin);
-    HashMapHolder<Player>::MapType const& plist = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = plist.begin(); itr != plist.end(); ++itr)
-        itr->second->SetAtLoginFlag(atLogin);
+    HashMapHolder<Player>::SnapshotType plist = sObjectAccessor.GetPlayersSnapshot();
+    for (HashMapHolder<Player>::SnapshotType::const_iterator itr = plist.begin(); itr != plist.end(); ++itr)
+        (*itr)->SetAtLoginFlag(atLogin);
 
     return true;
 }
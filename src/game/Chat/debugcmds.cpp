@@ -31,6 +31,12 @@
 #include "Entities/ObjectGuid.h"
 #include "Spells/SpellMgr.h"
 #include "Cinematics/M2Stores.h"
+#include "Maps/MapManager.h"
+#include "Entities/Pet.h"
+#include "Entities/Corpse.h"
+#include "Entities/DynamicObject.h"
+#include "Database/DatabaseEnv.h"
+#include "Database/SqlOperations.h"
 
 bool ChatHandler::HandleDebugSendSpellFailCommand(char* args)
 {
@@ -1206,3 +1212,112 @@ bool ChatHandler::HandleDebugSpellModsCommand(char* args)
 
     return true;
 }
+
+template<class T>
+static size_t GetObjectMemoryEstimate(uint16 valuesCount)
+{
+    return sizeof(T) + Object::GetValuesBlockWords(valuesCount) * sizeof(uint32);
+}
+
+template<class T>
+static void SendPoolMemoryStats(ChatHandler* handler, char const* name)
+{
+    size_t used, reserved;
+    ObjectPool<T>::GetStats(used, reserved);
+    handler->PSendSysMessage("%s pool: %u in use, %u reserved (%u KB)", name, uint32(used), uint32(reserved), uint32(reserved * sizeof(T) / 1024));
+}
+
+bool ChatHandler::HandleDebugMemoryCommand(char* /*args*/)
+{
+    // objects derived from the stored type (temporary spawns, totems, transports) are counted with the base size
+    size_t const creatureSize   = GetObjectMemoryEstimate<Creature>(UNIT_END);
+    size_t const petSize        = GetObjectMemoryEstimate<Pet>(UNIT_END);
+    size_t const gameObjectSize = GetObjectMemoryEstimate<GameObject>(GAMEOBJECT_END);
+    size_t const dynObjectSize  = GetObjectMemoryEstimate<DynamicObject>(DYNAMICOBJECT_END);
+
+    size_t totalBytes = 0;
+    sMapMgr.DoForAllMaps([&](Map* map)
+    {
+        Map::MapStoredObjectTypesContainer& store = map->GetObjectsStore();
+        size_t creatures   = store.size((Creature*)nullptr);
+        size_t pets        = store.size((Pet*)nullptr);
+        size_t gameObjects = store.size((GameObject*)nullptr);
+        size_t dynObjects  = store.size((DynamicObject*)nullptr);
+
+        size_t mapBytes = creatures * creatureSize + pets * petSize + gameObjects * gameObjectSize + dynObjects * dynObjectSize;
+        totalBytes += mapBytes;
+
+        PSendSysMessage("Map %u instance %u (%s): %u KB", map->GetId(), map->GetInstanceId(), map->GetMapName(), uint32(mapBytes / 1024));
+        PSendSysMessage("  creatures %u (%u KB), pets %u (%u KB), gameobjects %u (%u KB), dynamic objects %u (%u KB)",
+                        uint32(creatures), uint32(creatures * creatureSize / 1024), uint32(pets), uint32(pets * petSize / 1024),
+                        uint32(gameObjects), uint32(gameObjects * gameObjectSize / 1024), uint32(dynObjects), uint32(dynObjects * dynObjectSize / 1024));
+    });
+
+    PSendSysMessage("Total in maps: %u KB", uint32(totalBytes / 1024));
+    SendPoolMemoryStats<Creature>(this, "Creature");
+    SendPoolMemoryStats<GameObject>(this, "GameObject");
+    SendPoolMemoryStats<DynamicObject>(this, "DynamicObject");
+    SendPoolMemoryStats<Corpse>(this, "Corpse");
+    return true;
+}
+
+bool ChatHandler::HandleDebugGridsCommand(char* /*args*/)
+{
+    sMapMgr.DoForAllMaps([&](Map* map)
+    {
+        Map::GridLoadStats const& stats = map->GetGridLoadStats();
+        PSendSysMessage("Map %u instance %u (%s): %u grids, %u unloading", map->GetId(), map->GetInstanceId(), map->GetMapName(),
+                        map->GridRefManager<NGridType>::getSize(), map->GetPendingGridUnloadCount());
+        PSendSysMessage("  loads %u (avg %u ms, max %u ms), unloads %u (avg %u ms, max %u ms)",
+                        stats.loadCount, stats.loadCount ? uint32(stats.loadTimeTotal / stats.loadCount) : 0, stats.loadTimeMax,
+                        stats.unloadCount, stats.unloadCount ? uint32(stats.unloadTimeTotal / stats.unloadCount) : 0, stats.unloadTimeMax);
+    });
+    return true;
+}
+
+static void SendResultLatency(ChatHandler* handler, char const* name, Database& db)
+{
+    SqlResultQueue const* queue = db.GetResultQueue();
+    if (!queue)
+        return;
+
+    SqlResultQueue::LatencyHistogram const& latency = queue->GetLatencyHistogram();
+    handler->PSendSysMessage("%s: %u results, avg %u ms, max %u ms", name, latency.samples,
+                             latency.samples ? uint32(latency.totalTime / latency.samples) : 0, latency.maxTime);
+
+    std::ostringstream buckets;
+    for (uint32 i = 0; i < SQL_RESULT_LATENCY_BUCKETS; ++i)
+    {
+        if (i < SQL_RESULT_LATENCY_BUCKETS - 1)
+            buckets << "  <" << SqlResultQueue::LatencyHistogram::BucketLimits[i] << "ms: " << latency.buckets[i];
+        else
+            buckets << "  >=" << SqlResultQueue::LatencyHistogram::BucketLimits[i - 1] << "ms: " << latency.buckets[i];
+    }
+    handler->SendSysMessage(buckets.str().c_str());
+}
+
+bool ChatHandler::HandleDebugDbLatencyCommand(char* /*args*/)
+{
+    SendResultLatency(this, "Character", CharacterDatabase);
+    SendResultLatency(this, "World", WorldDatabase);
+    SendResultLatency(this, "Login", LoginDatabase);
+    return true;
+}
+
+static void SendTransactionStats(ChatHandler* handler, char const* name, Database& db)
+{
+    uint64 count = db.GetTransactionCount();
+    uint64 statements = db.GetTransactionStatements();
+    uint64 roundTrips = db.GetTransactionRoundTrips();
+
+    handler->PSendSysMessage("%s: " UI64FMTD " transactions, " UI64FMTD " statements (%.1f per transaction), " UI64FMTD " round trips (%.1f per transaction)",
+                             name, count, statements, count ? float(statements) / count : 0.0f, roundTrips, count ? float(roundTrips) / count : 0.0f);
+}
+
+bool ChatHandler::HandleDebugDbTransactionsCommand(char* /*args*/)
+{
+    SendTransactionStats(this, "Character", CharacterDatabase);
+    SendTransactionStats(this, "World", WorldDatabase);
+    SendTransactionStats(this, "Login", LoginDatabase);
+    return true;
+}
@@ -218,6 +218,115 @@ void ThreatContainer::clearReferences()
         delete(*i);
     }
     iThreatList.clear();
+    iThreatOrder.clear();
+    iRefIndex.clear();
+    iMovedRefs.clear();
+    iDirty = false;
+    iFullReorder = false;
+}
+
+//============================================================
+// Insert the reference behind all references with same or higher threat
+
+void ThreatContainer::addReference(HostileReference* pHostileReference)
+{
+    ThreatOrder::iterator pos = iThreatOrder.emplace(ThreatKey(pHostileReference->getThreat(), ++iSequence), iThreatList.end()).first;
+    ThreatOrder::iterator next = std::next(pos);
+    pos->second = iThreatList.insert(next != iThreatOrder.end() ? next->second : iThreatList.end(), pHostileReference);
+    iRefIndex[pHostileReference->getUnitGuid()] = pos;
+
+    // the successor might not be at its place yet
+    if (iDirty)
+        markMoved(pHostileReference->getUnitGuid());
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* pRef)
+{
+    ThreatRefIndex::iterator found = iRefIndex.find(pRef->getUnitGuid());
+    if (found == iRefIndex.end() || *found->second->second != pRef)
+        return;
+
+    iThreatList.erase(found->second->second);
+    iThreatOrder.erase(found->second);
+    iRefIndex.erase(found);
+}
+
+//============================================================
+
+void ThreatContainer::threatChanged(HostileReference* pRef)
+{
+    ThreatRefIndex::iterator found = iRefIndex.find(pRef->getUnitGuid());
+    if (found == iRefIndex.end() || *found->second->second != pRef)
+        return;
+
+    ThreatList::iterator node = found->second->second;
+    ThreatOrder::iterator next = iThreatOrder.erase(found->second);
+    found->second = iThreatOrder.emplace(ThreatKey(pRef->getThreat(), ++iSequence), node).first;
+
+    // same successor, same place in the list
+    if (std::next(found->second) != next)
+        markMoved(pRef->getUnitGuid());
+}
+
+//============================================================
+
+void ThreatContainer::markMoved(ObjectGuid const& guid)
+{
+    iDirty = true;
+    if (iFullReorder)
+        return;
+
+    // more moved references than the list holds, walking the whole order is cheaper
+    if (iMovedRefs.size() >= iRefIndex.size())
+    {
+        iMovedRefs.clear();
+        iFullReorder = true;
+        return;
+    }
+
+    iMovedRefs.push_back(guid);
+}
+
+//============================================================
+// Move the list nodes of the changed references to their place in the threat order.
+// splice relinks nodes, so list iterators and the order index stay valid.
+
+void ThreatContainer::update()
+{
+    if (!iDirty)
+        return;
+
+    iDirty = false;
+
+    if (iFullReorder)
+    {
+        iFullReorder = false;
+        for (ThreatOrder::const_iterator itr = iThreatOrder.begin(); itr != iThreatOrder.end(); ++itr)
+            iThreatList.splice(iThreatList.end(), iThreatList, itr->second);
+        return;
+    }
+
+    std::vector<ThreatOrder::iterator> moved;
+    moved.reserve(iMovedRefs.size());
+    for (std::vector<ObjectGuid>::const_iterator itr = iMovedRefs.begin(); itr != iMovedRefs.end(); ++itr)
+    {
+        ThreatRefIndex::const_iterator found = iRefIndex.find(*itr);
+        if (found != iRefIndex.end())                       // skip references removed meanwhile
+            moved.push_back(found->second);
+    }
+    iMovedRefs.clear();
+
+    // last in threat order first, each goes in front of its successor, which either did not move or is already placed
+    std::sort(moved.begin(), moved.end(), [](ThreatOrder::iterator const& lhs, ThreatOrder::iterator const& rhs) { return rhs->first < lhs->first; });
+    moved.erase(std::unique(moved.begin(), moved.end()), moved.end());
+
+    for (std::vector<ThreatOrder::iterator>::const_iterator itr = moved.begin(); itr != moved.end(); ++itr)
+    {
+        ThreatOrder::iterator next = std::next(*itr);
+        iThreatList.splice(next != iThreatOrder.end() ? next->second : iThreatList.end(), iThreatList, (*itr)->second);
+    }
 }
 
 //============================================================
@@ -226,18 +335,9 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* pVictim)
 {
     if (!pVictim)
         return nullptr;
-    HostileReference* result = nullptr;
-    ObjectGuid guid = pVictim->GetObjectGuid();
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        if ((*i)->getUnitGuid() == guid)
-        {
-            result = (*i);
-            break;
-        }
-    }
 
-    return result;
+    ThreatRefIndex::const_iterator found = iRefIndex.find(pVictim->GetObjectGuid());
+    return found != iRefIndex.end() ? *found->second->second : nullptr;
 }
 
 //============================================================
@@ -267,26 +367,6 @@ void ThreatContainer::modifyThreatPercent(Unit* pVictim, int32 pPercent)
     }
 }
 
-//============================================================
-
-bool HostileReferenceSortPredicate(const HostileReference* lhs, const HostileReference* rhs)
-{
-    // std::list::sort ordering predicate must be: (Pred(x,y)&&Pred(y,x))==false
-    return lhs->getThreat() > rhs->getThreat();             // reverse sorting
-}
-
-//============================================================
-// Check if the list is dirty and sort if necessary
-
-void ThreatContainer::update()
-{
-    if (iDirty && iThreatList.size() > 1)
-    {
-        iThreatList.sort(HostileReferenceSortPredicate);
-    }
-    iDirty = false;
-}
-
 //============================================================
 // return the next best victim
 // could be the current victim
@@ -564,18 +644,17 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
     switch (threatRefStatusChangeEvent->getType())
     {
         case UEV_THREAT_REF_THREAT_CHANGE:
-            if ((getCurrentVictim() == hostileReference && threatRefStatusChangeEvent->getFValue() < 0.0f) ||
-                    (getCurrentVictim() != hostileReference && threatRefStatusChangeEvent->getFValue() > 0.0f))
-                setDirty(true);                             // the order in the threat list might have changed
+            // the list itself is reordered in the next getHostileTarget()
+            if (hostileReference->isOnline())
+                iThreatContainer.threatChanged(hostileReference);
+            else
+                iThreatOfflineContainer.threatChanged(hostileReference);
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
             if (!hostileReference->isOnline())
             {
                 if (hostileReference == getCurrentVictim())
-                {
                     setCurrentVictim(nullptr);
-                    setDirty(true);
-                }
                 iOwner->SendThreatRemove(hostileReference);
                 iThreatContainer.remove(hostileReference);
                 iUpdateNeed = true;
@@ -583,8 +662,6 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
             }
             else
             {
-                if (getCurrentVictim() && hostileReference->getThreat() > (1.1f * getCurrentVictim()->getThreat()))
-                    setDirty(true);
                 iThreatContainer.addReference(hostileReference);
                 iUpdateNeed = true;
                 iThreatOfflineContainer.remove(hostileReference);
@@ -592,10 +669,7 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
             break;
         case UEV_THREAT_REF_REMOVE_FROM_LIST:
             if (hostileReference == getCurrentVictim())
-            {
                 setCurrentVictim(nullptr);
-                setDirty(true);
-            }
             if (hostileReference->isOnline())
             {
                 iOwner->SendThreatRemove(hostileReference);
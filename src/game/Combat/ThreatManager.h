@@ -26,6 +26,9 @@
 #include "Util/Timer.h"
 #include "Entities/ObjectGuid.h"
 #include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 //==============================================================
 
@@ -136,21 +139,47 @@ class ThreatManager;
 
 typedef std::list<HostileReference*> ThreatList;
 
+// The threat list is ordered by threat (highest first). A threat change repositions the reference in the
+// threat order index at once, the list only follows in update(), so callers iterating the list while
+// changing threat don't see references move under them. Lookups by victim use the guid index.
 class ThreatContainer
 {
     private:
+        // highest threat first, equal threat in the order the threat was set
+        struct ThreatKey
+        {
+            ThreatKey(float pThreat, uint64 pSequence) : threat(pThreat), sequence(pSequence) {}
+
+            bool operator<(ThreatKey const& other) const { return threat != other.threat ? threat > other.threat : sequence < other.sequence; }
+
+            float threat;
+            uint64 sequence;
+        };
+
+        typedef std::map<ThreatKey, ThreatList::iterator> ThreatOrder;
+        typedef std::unordered_map<ObjectGuid, ThreatOrder::iterator> ThreatRefIndex;
+
         ThreatList iThreatList;
+        ThreatOrder iThreatOrder;
+        ThreatRefIndex iRefIndex;
+        std::vector<ObjectGuid> iMovedRefs;                 // references whose list position is outdated
+        uint64 iSequence;
         bool iDirty;
+        bool iFullReorder;                                  // too many moved references, reorder the whole list
+
+        void markMoved(ObjectGuid const& guid);
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* pRef) { iThreatList.remove(pRef); }
-        void addReference(HostileReference* pHostileReference) { iThreatList.push_back(pHostileReference); }
+        void remove(HostileReference* pRef);
+        void addReference(HostileReference* pHostileReference);
         void clearReferences();
-        // Sort the list if necessary
+        // Reposition the reference in the threat order after its threat changed
+        void threatChanged(HostileReference* pRef);
+        // Move the list nodes of changed references to their place in the threat order
         void update();
     public:
-        ThreatContainer() { iDirty = false; }
+        ThreatContainer() : iSequence(0), iDirty(false), iFullReorder(false) {}
         ~ThreatContainer() { clearReferences(); }
 
         HostileReference* addThreat(Unit* pVictim, float pThreat);
@@ -159,8 +188,6 @@ class ThreatContainer
 
         HostileReference* selectNextVictim(Creature* pAttacker, HostileReference* pCurrentVictim);
 
-        void setDirty(bool pDirty) { iDirty = pDirty; }
-
         bool isDirty() const { return iDirty; }
 
         bool empty() const { return iThreatList.empty(); }
@@ -212,8 +239,6 @@ class ThreatManager
 
         void setCurrentVictim(HostileReference* pHostileReference);
 
-        void setDirty(bool pDirty) { iThreatContainer.setDirty(pDirty); }
-
         // Don't must be used for explicit modify threat values in iterator return pointers
         ThreatList const& getThreatList() const { return iThreatContainer.getThreatList(); }
     private:
@@ -0,0 +1,203 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "DBScripts/ScriptSchedule.h"
+
+#include <algorithm>
+
+static inline size_t HashCombine(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+size_t ScriptSchedule::KeyHash::operator()(RunKey const& key) const
+{
+    size_t h = std::hash<const char*>()(key.table);
+    h = HashCombine(h, std::hash<uint32>()(key.id));
+    h = HashCombine(h, std::hash<uint64>()(key.sourceGuid.GetRawValue()));
+    h = HashCombine(h, std::hash<uint64>()(key.targetGuid.GetRawValue()));
+    return HashCombine(h, std::hash<uint64>()(key.ownerGuid.GetRawValue()));
+}
+
+size_t ScriptSchedule::KeyHash::operator()(PartialKey const& key) const
+{
+    size_t h = std::hash<const char*>()(key.table);
+    h = HashCombine(h, std::hash<uint32>()(key.id));
+    return HashCombine(h, std::hash<uint64>()(key.guid.GetRawValue()));
+}
+
+void ScriptSchedule::Add(time_t execTime, ScriptAction const& action)
+{
+    RunKey run(action.GetTableName(), action.GetId(), action.GetSourceGuid(), action.GetTargetGuid(), action.GetOwnerGuid());
+
+    uint64 sequence = m_nextSequence++;
+    m_actions.emplace(sequence, ScheduledAction(action, run));
+    m_queue.push(QueueEntry(execTime, sequence));
+
+    std::vector<uint64>& steps = m_runs[run];
+    if (steps.empty())                                      // new run, register in indexes
+    {
+        if (run.sourceGuid)
+            m_runsBySource[PartialKey(run.table, run.id, run.sourceGuid)].push_back(run);
+        if (run.targetGuid)
+            m_runsByTarget[PartialKey(run.table, run.id, run.targetGuid)].push_back(run);
+    }
+    steps.push_back(sequence);
+}
+
+void ScriptSchedule::FindRuns(const char* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid, std::vector<RunKey>& result, bool firstOnly) const
+{
+    auto matches = [&](RunKey const& run)
+    {
+        return run.table == table && run.id == id &&
+               (!sourceGuid || run.sourceGuid == sourceGuid) &&
+               (!targetGuid || run.targetGuid == targetGuid) &&
+               (!ownerGuid || run.ownerGuid == ownerGuid);
+    };
+
+    RunIndex const* index = nullptr;
+    if (sourceGuid)
+        index = &m_runsBySource;
+    else if (targetGuid)
+        index = &m_runsByTarget;
+
+    if (index)
+    {
+        RunIndex::const_iterator itr = index->find(PartialKey(table, id, sourceGuid ? sourceGuid : targetGuid));
+        if (itr == index->end())
+            return;
+
+        for (RunKey const& run : itr->second)
+        {
+            if (matches(run))
+            {
+                result.push_back(run);
+                if (firstOnly)
+                    return;
+            }
+        }
+        return;
+    }
+
+    // no guid given, only happens for scripts without source and target
+    for (RunMap::const_iterator itr = m_runs.begin(); itr != m_runs.end(); ++itr)
+    {
+        if (matches(itr->first))
+        {
+            result.push_back(itr->first);
+            if (firstOnly)
+                return;
+        }
+    }
+}
+
+bool ScriptSchedule::IsScheduled(const char* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid) const
+{
+    std::vector<RunKey> runs;
+    FindRuns(table, id, sourceGuid, targetGuid, ownerGuid, runs, true);
+    return !runs.empty();
+}
+
+size_t ScriptSchedule::Terminate(const char* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid)
+{
+    std::vector<RunKey> runs;
+    FindRuns(table, id, sourceGuid, targetGuid, ownerGuid, runs, false);
+
+    size_t count = 0;
+    for (RunKey const& run : runs)
+    {
+        RunMap::iterator itr = m_runs.find(run);
+        for (uint64 sequence : itr->second)
+            count += m_actions.erase(sequence);
+
+        RemoveRun(run);
+    }
+
+    if (m_actions.empty())                                  // drop skipped entries at once
+        m_queue = ScheduleQueue();
+
+    return count;
+}
+
+ScriptAction const* ScriptSchedule::GetNextDue(time_t now, uint64& sequence)
+{
+    while (!m_queue.empty() && m_queue.top().first <= now)
+    {
+        ActionMap::const_iterator itr = m_actions.find(m_queue.top().second);
+        if (itr == m_actions.end())                         // already removed
+        {
+            m_queue.pop();
+            continue;
+        }
+
+        sequence = itr->first;
+        return &itr->second.action;
+    }
+
+    return nullptr;
+}
+
+bool ScriptSchedule::Remove(uint64 sequence)
+{
+    ActionMap::iterator itr = m_actions.find(sequence);
+    if (itr == m_actions.end())
+        return false;
+
+    RunMap::iterator runItr = m_runs.find(itr->second.run);
+    std::vector<uint64>& steps = runItr->second;
+    steps.erase(std::find(steps.begin(), steps.end(), sequence));
+    if (steps.empty())
+        RemoveRun(runItr->first);
+
+    m_actions.erase(itr);
+
+    if (!m_queue.empty() && m_queue.top().second == sequence)
+        m_queue.pop();
+
+    return true;
+}
+
+void ScriptSchedule::RemoveRun(RunKey const& run)
+{
+    RunKey key = run;                                       // may point into the erased node
+
+    if (key.sourceGuid)
+        RemoveFromIndex(m_runsBySource, PartialKey(key.table, key.id, key.sourceGuid), key);
+    if (key.targetGuid)
+        RemoveFromIndex(m_runsByTarget, PartialKey(key.table, key.id, key.targetGuid), key);
+
+    m_runs.erase(key);
+}
+
+void ScriptSchedule::RemoveFromIndex(RunIndex& index, PartialKey const& key, RunKey const& run)
+{
+    RunIndex::iterator itr = index.find(key);
+    if (itr == index.end())
+        return;
+
+    std::vector<RunKey>& runs = itr->second;
+    std::vector<RunKey>::iterator runItr = std::find(runs.begin(), runs.end(), run);
+    if (runItr != runs.end())
+    {
+        *runItr = runs.back();
+        runs.pop_back();
+    }
+
+    if (runs.empty())
+        index.erase(itr);
+}
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _SCRIPTSCHEDULE_H
+#define _SCRIPTSCHEDULE_H
+
+#include "Common.h"
+#include "DBScripts/ScriptMgr.h"
+
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Pending DB-script steps of a map.
+ *
+ * Steps are executed in (time, insertion) order from a min-heap. All steps started by the same
+ * ScriptsStart call share one "run" (table, id, source, target, owner), runs are indexed by source
+ * and by target so uniqueness checks and termination do not need to scan every scheduled step.
+ * Removed steps stay in the heap until they get due and are skipped there.
+ */
+class ScriptSchedule
+{
+    public:
+        ScriptSchedule() : m_nextSequence(1) {}
+
+        void Add(time_t execTime, ScriptAction const& action);
+
+        // true if a step of a matching script is scheduled, empty guids match everything (see ScriptAction::IsSameScript)
+        bool IsScheduled(const char* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid) const;
+        // remove all steps of matching scripts, returns amount of removed steps
+        size_t Terminate(const char* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid);
+
+        // fetch the earliest step due at 'now', the step stays scheduled until Remove
+        ScriptAction const* GetNextDue(time_t now, uint64& sequence);
+        // remove a single step, returns false if it was already removed
+        bool Remove(uint64 sequence);
+
+        bool empty() const { return m_actions.empty(); }
+        size_t size() const { return m_actions.size(); }
+
+    private:
+        struct RunKey
+        {
+            RunKey(const char* _table, uint32 _id, ObjectGuid _sourceGuid, ObjectGuid _targetGuid, ObjectGuid _ownerGuid) :
+                table(_table), id(_id), sourceGuid(_sourceGuid), targetGuid(_targetGuid), ownerGuid(_ownerGuid) {}
+
+            bool operator==(RunKey const& other) const
+            {
+                return table == other.table && id == other.id && sourceGuid == other.sourceGuid && targetGuid == other.targetGuid && ownerGuid == other.ownerGuid;
+            }
+
+            const char* table;
+            uint32 id;
+            ObjectGuid sourceGuid;
+            ObjectGuid targetGuid;
+            ObjectGuid ownerGuid;
+        };
+
+        // (table, id, source or target guid)
+        struct PartialKey
+        {
+            PartialKey(const char* _table, uint32 _id, ObjectGuid _guid) : table(_table), id(_id), guid(_guid) {}
+
+            bool operator==(PartialKey const& other) const { return table == other.table && id == other.id && guid == other.guid; }
+
+            const char* table;
+            uint32 id;
+            ObjectGuid guid;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(RunKey const& key) const;
+            size_t operator()(PartialKey const& key) const;
+        };
+
+        struct ScheduledAction
+        {
+            ScheduledAction(ScriptAction const& _action, RunKey const& _run) : action(_action), run(_run) {}
+
+            ScriptAction action;
+            RunKey run;
+        };
+
+        typedef std::pair<time_t, uint64 /*sequence*/> QueueEntry;
+        typedef std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > ScheduleQueue;
+        typedef std::unordered_map<uint64 /*sequence*/, ScheduledAction> ActionMap;
+        typedef std::unordered_map<RunKey, std::vector<uint64> /*sequences*/, KeyHash> RunMap;
+        typedef std::unordered_map<PartialKey, std::vector<RunKey>, KeyHash> RunIndex;
+
+        // collect runs matching the given values, stops after the first match if firstOnly is set
+        void FindRuns(const char* table, uint32 id, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid, std::vector<RunKey>& result, bool firstOnly) const;
+
+        void RemoveRun(RunKey const& run);
+        static void RemoveFromIndex(RunIndex& index, PartialKey const& key, RunKey const& run);
+
+        uint64 m_nextSequence;
+        ScheduleQueue m_queue;
+        ActionMap m_actions;
+        RunMap m_runs;
+        RunIndex m_runsBySource;
+        RunIndex m_runsByTarget;
+};
+
+#endif
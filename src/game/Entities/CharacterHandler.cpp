@@ -506,6 +506,7 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
 
     // Player created, save it now
     pNewChar->SaveToDB();
+    sObjectMgr.AddCharacterIdentity(pNewChar->GetObjectGuid(), GetAccountId(), pNewChar->GetName(), pNewChar->getRace(), pNewChar->getClass(), pNewChar->getGender());
     charcount += 1;
 
     LoginDatabase.PExecute("DELETE FROM realmcharacters WHERE acctid= '%u' AND realmid = '%u'", GetAccountId(), realmID);
@@ -762,6 +763,7 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder *holder)
 
             guild->DisplayGuildBankTabsInfo(this);
 
+            guild->MemberLoggedIn(pCurrChar);
             guild->BroadcastEvent(GE_SIGNED_ON, pCurrChar->GetObjectGuid(), pCurrChar->GetName());
         }
         else
@@ -1087,6 +1089,8 @@ void WorldSession::HandleChangePlayerNameOpcodeCallBack(QueryResult* result, uin
     CharacterDatabase.PExecute("DELETE FROM character_declinedname WHERE guid ='%u'", guidLow);
     CharacterDatabase.CommitTransaction();
 
+    sObjectMgr.RenameCharacterIdentity(guid, newname);
+
     sLog.outChar("Account: %d (IP: %s) Character:[%s] (guid:%u) Changed name to: %s", session->GetAccountId(), session->GetRemoteAddress().c_str(), oldname.c_str(), guidLow, newname.c_str());
 
     WorldPacket data(SMSG_CHAR_RENAME, 1 + 8 + (newname.size() + 1));
@@ -1164,6 +1168,8 @@ void WorldSession::HandleSetPlayerDeclinedNamesOpcode(WorldPacket& recv_data)
         return;
     }
 
+    sObjectMgr.SetCharacterIdentityDeclinedNames(guid, &declinedname);
+
     for (int i = 0; i < MAX_DECLINED_NAME_CASES; ++i)
         CharacterDatabase.escape_string(declinedname.name[i]);
 
@@ -1325,6 +1331,8 @@ void WorldSession::HandleCharCustomizeOpcode(WorldPacket& recv_data)
         return;
     }
 
+    sObjectMgr.RenameCharacterIdentity(guid, newname);
+
     CharacterDatabase.escape_string(newname);
     Player::Customize(guid, gender, skin, face, hairStyle, hairColor, facialHair);
     CharacterDatabase.PExecute("UPDATE characters set name = '%s', at_login = at_login & ~ %u WHERE guid ='%u'", newname.c_str(), uint32(AT_LOGIN_CUSTOMIZE), guid.GetCounter());
@@ -52,6 +52,9 @@ class Corpse : public WorldObject
         explicit Corpse(CorpseType type = CORPSE_BONES);
         ~Corpse();
 
+        static void* operator new(size_t size) { return ObjectPool<Corpse>::Allocate(size); }
+        static void operator delete(void* ptr, size_t size) { ObjectPool<Corpse>::Deallocate(ptr, size); }
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
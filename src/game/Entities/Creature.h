@@ -554,6 +554,9 @@ class Creature : public Unit
         explicit Creature(CreatureSubtype subtype = CREATURE_SUBTYPE_GENERIC);
         virtual ~Creature();
 
+        static void* operator new(size_t size) { return ObjectPool<Creature>::Allocate(size); }
+        static void operator delete(void* ptr, size_t size) { ObjectPool<Creature>::Deallocate(ptr, size); }
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
         virtual void CleanupsBeforeDelete() override;
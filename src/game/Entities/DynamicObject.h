@@ -38,6 +38,9 @@ class DynamicObject : public WorldObject
     public:
         explicit DynamicObject();
 
+        static void* operator new(size_t size) { return ObjectPool<DynamicObject>::Allocate(size); }
+        static void operator delete(void* ptr, size_t size) { ObjectPool<DynamicObject>::Deallocate(ptr, size); }
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
@@ -661,6 +661,9 @@ class GameObject : public WorldObject
         explicit GameObject();
         ~GameObject();
 
+        static void* operator new(size_t size) { return ObjectPool<GameObject>::Allocate(size); }
+        static void operator delete(void* ptr, size_t size) { ObjectPool<GameObject>::Deallocate(ptr, size); }
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
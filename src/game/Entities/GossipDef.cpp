@@ -22,6 +22,7 @@
 #include "Server/Opcodes.h"
 #include "Server/WorldPacket.h"
 #include "Server/WorldSession.h"
+#include "Entities/QueryResponseCache.h"
 #include "Tools/Formulas.h"
 
 GossipMenu::GossipMenu(WorldSession* session) : m_session(session)
@@ -567,6 +568,14 @@ void PlayerMenu::SendQuestGiverQuestDetails(Quest const* pQuest, ObjectGuid guid
 // send only static data in this packet!
 void PlayerMenu::SendQuestQueryResponse(Quest const* pQuest)
 {
+    int loc_idx = GetMenuSession()->GetSessionDbLocaleIndex();
+
+    if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_QUEST, pQuest->GetQuestId(), loc_idx))
+    {
+        GetMenuSession()->SendPacket(*response);
+        return;
+    }
+
     std::string Title, Details, Objectives, EndText, CompletedText;
     std::string PortraitGiverText, PortraitGiverName;
     std::string PortraitTurnInText, PortraitTurnInName;
@@ -584,7 +593,6 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* pQuest)
     for (int i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
         ObjectiveText[i] = pQuest->ObjectiveText[i];
 
-    int loc_idx = GetMenuSession()->GetSessionDbLocaleIndex();
     if (loc_idx >= 0)
     {
         if (QuestLocale const* ql = sObjectMgr.GetQuestLocale(pQuest->GetQuestId()))
@@ -756,6 +764,7 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* pQuest)
     data << uint32(pQuest->GetSoundAcceptId());
     data << uint32(pQuest->GetSoundTurnInId());
 
+    sQueryResponseCache.Insert(QUERY_RESPONSE_QUEST, pQuest->GetQuestId(), loc_idx, data);
     GetMenuSession()->SendPacket(data);
     DEBUG_LOG("WORLD: Sent SMSG_QUEST_QUERY_RESPONSE questid=%u", pQuest->GetQuestId());
 }
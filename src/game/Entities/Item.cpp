@@ -451,12 +451,15 @@ void Item::SaveToDB()
             SqlStatement stmt = CharacterDatabase.CreateStatement(delItem, "DELETE FROM item_instance WHERE guid = ?");
             stmt.PExecute(guid);
 
-            std::ostringstream ss;
-            for (uint16 i = 0; i < m_valuesCount; ++i)
-                ss << GetUInt32Value(i) << " ";
+            std::string data;
+            SaveValues(data);
 
             stmt = CharacterDatabase.CreateStatement(insItem, "INSERT INTO item_instance (guid,owner_guid,data,text) VALUES (?, ?, ?, ?)");
-            stmt.PExecute(guid, GetOwnerGuid().GetCounter(), ss.str().c_str(), m_text.c_str());
+            stmt.addUInt32(guid);
+            stmt.addUInt32(GetOwnerGuid().GetCounter());
+            stmt.addBinary(data);
+            stmt.addString(m_text);
+            stmt.Execute();
         } break;
         case ITEM_CHANGED:
         {
@@ -465,11 +468,14 @@ void Item::SaveToDB()
 
             SqlStatement stmt = CharacterDatabase.CreateStatement(updInstance, "UPDATE item_instance SET data = ?, owner_guid = ?, text = ? WHERE guid = ?");
 
-            std::ostringstream ss;
-            for (uint16 i = 0; i < m_valuesCount; ++i)
-                ss << GetUInt32Value(i) << " ";
+            std::string data;
+            SaveValues(data);
 
-            stmt.PExecute(ss.str().c_str(), GetOwnerGuid().GetCounter(), m_text.c_str(), guid);
+            stmt.addBinary(data);
+            stmt.addUInt32(GetOwnerGuid().GetCounter());
+            stmt.addString(m_text);
+            stmt.addUInt32(guid);
+            stmt.Execute();
 
             if (HasFlag(ITEM_FIELD_FLAGS, ITEM_DYNFLAG_WRAPPED))
             {
@@ -559,7 +565,7 @@ bool Item::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
     // and allow use "FSetState(ITEM_REMOVED); SaveToDB();" for deleting item from DB
     Object::_Create(guidLow, 0, HIGHGUID_ITEM);
 
-    if (!LoadValues(fields[0].GetString()))
+    if (!LoadValues(fields[0]))
     {
         sLog.outError("Item #%d have broken data in `data` field. Can't be loaded.", guidLow);
         return false;
@@ -642,11 +648,10 @@ bool Item::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
 
         SqlStatement stmt = CharacterDatabase.CreateStatement(updItem, "UPDATE item_instance SET data = ?, owner_guid = ? WHERE guid = ?");
 
-        std::ostringstream ss;
-        for (uint16 i = 0; i < m_valuesCount; ++i)
-            ss << GetUInt32Value(i) << " ";
+        std::string data;
+        SaveValues(data);
 
-        stmt.addString(ss);
+        stmt.addBinary(data);
         stmt.addUInt32(GetOwnerGuid().GetCounter());
         stmt.addUInt32(guidLow);
         stmt.Execute();
@@ -24,6 +24,7 @@
 #include "Globals/ObjectMgr.h"
 #include "Entities/Player.h"
 #include "Entities/Item.h"
+#include "Entities/QueryResponseCache.h"
 #include "Entities/UpdateData.h"
 #include "Chat/Chat.h"
 
@@ -1323,6 +1324,13 @@ void WorldSession::HandleItemTextQuery(WorldPacket& recv_data)
 
 void WorldSession::SendItemDb2Reply(uint32 entry)
 {
+    // item db2 records are not localized
+    if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_ITEM, entry, -1))
+    {
+        SendPacket(*response);
+        return;
+    }
+
     WorldPacket data(SMSG_DB_REPLY, 44);
     ItemPrototype const* proto = sObjectMgr.GetItemPrototype(entry);
     if (!proto)
@@ -1352,11 +1360,19 @@ void WorldSession::SendItemDb2Reply(uint32 entry)
     data << uint32(buff.size());
     data.append(buff);
 
+    sQueryResponseCache.Insert(QUERY_RESPONSE_ITEM, entry, -1, data);
     SendPacket(data);
 }
 
 void WorldSession::SendItemSparseDb2Reply(uint32 entry)
 {
+    // item db2 records are not localized
+    if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_ITEM_SPARSE, entry, -1))
+    {
+        SendPacket(*response);
+        return;
+    }
+
     WorldPacket data(SMSG_DB_REPLY, 526);
     ItemPrototype const* proto = sObjectMgr.GetItemPrototype(entry);
     if (!proto)
@@ -1485,5 +1501,6 @@ void WorldSession::SendItemSparseDb2Reply(uint32 entry)
     data << uint32(buff.size());
     data.append(buff);
 
+    sQueryResponseCache.Insert(QUERY_RESPONSE_ITEM_SPARSE, entry, -1, data);
     SendPacket(data);
 }
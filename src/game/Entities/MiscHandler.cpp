@@ -40,6 +40,7 @@
 #include "Guilds/Guild.h"
 #include "Entities/Pet.h"
 #include "Social/SocialMgr.h"
+#include "World/WhoListStorage.h"
 #include "Server/DBCEnums.h"
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
@@ -155,93 +156,72 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recv_data)
     data << uint32(matchcount);                             // placeholder, count of players matching criteria
     data << uint32(displaycount);                           // placeholder, count of players displayed
 
-    // TODO: Guard Player map
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
-    {
-        Player* pl = itr->second;
-
-        if (security == SEC_PLAYER)
-        {
-            // player can see member of other team only if CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST
-            if (pl->GetTeam() != team && !allowTwoSideWhoList)
-                continue;
-
-            // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
-            if (pl->GetSession()->GetSecurity() > gmLevelInWhoList)
-                continue;
-        }
-
-        // do not process players which are not in world
-        if (!pl->IsInWorld())
-            continue;
+    std::shared_ptr<WhoListSnapshot const> snapshot = sWhoListStorage.GetSnapshot();
+    WhoListSnapshot const& who = *snapshot;
 
-        // check if target is globally visible for player
-        if (!pl->IsVisibleGloballyFor(_player))
-            continue;
+    // numeric filters first, a column at a time
+    std::vector<uint32> rows;
+    rows.reserve(who.Size());
+    for (uint32 i = 0; i < who.Size(); ++i)
+        if (who.level[i] >= level_min && who.level[i] <= level_max)
+            rows.push_back(i);
 
-        // check if target's level is in level range
-        uint32 lvl = pl->GetLevel();
-        if (lvl < level_min || lvl > level_max)
-            continue;
+    auto filter = [&rows](std::function<bool(uint32)> const& match)
+    {
+        rows.erase(std::remove_if(rows.begin(), rows.end(), [&match](uint32 i) { return !match(i); }), rows.end());
+    };
 
-        // check if class matches classmask
-        uint32 class_ = pl->getClass();
-        if (!(classmask & (1 << class_)))
-            continue;
+    filter([&](uint32 i) { return (classmask & (1 << who.class_[i])) && (racemask & (1 << who.race[i])); });
 
-        // check if race matches racemask
-        uint32 race = pl->getRace();
-        if (!(racemask & (1 << race)))
-            continue;
+    if (zones_count)
+        filter([&](uint32 i) { return std::find(zoneids, zoneids + zones_count, who.zone[i]) != zoneids + zones_count; });
 
-        uint32 pzoneid = pl->GetZoneId();
-        uint8 gender = pl->getGender();
+    if (security == SEC_PLAYER)
+    {
+        // player can see member of other team only if CONFIG_BOOL_ALLOW_TWO_SIDE_WHO_LIST
+        // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
+        filter([&](uint32 i) { return (allowTwoSideWhoList || who.team[i] == uint32(team)) && who.security[i] <= gmLevelInWhoList; });
+    }
 
-        bool z_show = true;
-        for (uint32 i = 0; i < zones_count; ++i)
-        {
-            if (zoneids[i] == pzoneid)
-            {
-                z_show = true;
-                break;
-            }
+    // check if target is globally visible for player, same as Player::IsVisibleGloballyFor
+    uint32 selfGuid = _player->GetGUIDLow();
+    filter([&](uint32 i)
+    {
+        if (who.guidLow[i] == selfGuid || who.visibility[i] == VISIBILITY_ON)
+            return true;
 
-            z_show = false;
-        }
-        if (!z_show)
-            continue;
+        if (security > SEC_PLAYER)
+            return who.security[i] <= security;
 
-        std::string pname = pl->GetName();
-        std::wstring wpname;
-        if (!Utf8toWStr(pname, wpname))
-            continue;
-        wstrToLower(wpname);
+        return who.visibility[i] != VISIBILITY_OFF;
+    });
 
+    for (uint32 i : rows)
+    {
+        std::wstring const& wpname = who.lowerName[i];
         if (!(wplayer_name.empty() || wpname.find(wplayer_name) != std::wstring::npos))
             continue;
 
-        std::string gname = sGuildMgr.GetGuildNameById(pl->GetGuildId());
-        std::wstring wgname;
-        if (!Utf8toWStr(gname, wgname))
-            continue;
-        wstrToLower(wgname);
-
+        std::wstring const& wgname = who.lowerGuildName[i];
         if (!(wguild_name.empty() || wgname.find(wguild_name) != std::wstring::npos))
             continue;
 
-        std::string aname;
-        if (AreaTableEntry const* areaEntry = GetAreaEntryByAreaID(pzoneid))
-            aname = areaEntry->area_name[GetSessionDbcLocale()];
+        uint32 pzoneid = who.zone[i];
 
         bool s_show = true;
-        for (uint32 i = 0; i < str_count; ++i)
+        for (uint32 j = 0; j < str_count; ++j)
         {
-            if (!str[i].empty())
+            if (!str[j].empty())
             {
-                if (wgname.find(str[i]) != std::wstring::npos ||
-                        wpname.find(str[i]) != std::wstring::npos ||
-                        Utf8FitTo(aname, str[i]))
+                if (wgname.find(str[j]) != std::wstring::npos ||
+                        wpname.find(str[j]) != std::wstring::npos)
+                {
+                    s_show = true;
+                    break;
+                }
+
+                AreaTableEntry const* areaEntry = GetAreaEntryByAreaID(pzoneid);
+                if (areaEntry && Utf8FitTo(areaEntry->area_name[GetSessionDbcLocale()], str[j]))
                 {
                     s_show = true;
                     break;
@@ -258,12 +238,12 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recv_data)
 
         ++displaycount;
 
-        data << pname;                                      // player name
-        data << gname;                                      // guild name
-        data << uint32(lvl);                                // player level
-        data << uint32(class_);                             // player class
-        data << uint32(race);                               // player race
-        data << uint8(gender);                              // player gender
+        data << who.name[i];                                // player name
+        data << who.guildName[i];                           // guild name
+        data << uint32(who.level[i]);                       // player level
+        data << uint32(who.class_[i]);                      // player class
+        data << uint32(who.race[i]);                        // player race
+        data << uint8(who.gender[i]);                       // player gender
         data << uint32(pzoneid);                            // player zone id
     }
 
@@ -28,6 +28,7 @@
 #include "Globals/ObjectMgr.h"
 #include "Entities/ObjectGuid.h"
 #include "Entities/UpdateData.h"
+#include "Entities/UpdateFieldsBlob.h"
 #include "UpdateMask.h"
 #include "Util/Util.h"
 #include "Maps/MapManager.h"
@@ -53,6 +54,7 @@ Object::Object(): m_updateFlag(0), m_scriptRef(this, NoopObjectDeleter())
     m_objectType        = TYPEMASK_OBJECT;
 
     m_uint32Values      = nullptr;
+    m_changedValues     = nullptr;
     m_valuesCount       = 0;
 
     m_inWorld           = false;
@@ -106,10 +108,12 @@ void Object::RemoveFromWorld()
 
 void Object::_InitValues()
 {
-    m_uint32Values = new uint32[ m_valuesCount ];
-    memset(m_uint32Values, 0, m_valuesCount * sizeof(uint32));
+    // values and their change flags share one block
+    size_t words = GetValuesBlockWords(m_valuesCount);
+    m_uint32Values = new uint32[words];
+    memset(m_uint32Values, 0, words * sizeof(uint32));
 
-    m_changedValues.resize(m_valuesCount, false);
+    m_changedValues = reinterpret_cast<uint8*>(m_uint32Values + m_valuesCount);
 
     m_objectUpdated = false;
 }
@@ -203,6 +207,9 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) c
 
 void Object::SendCreateUpdateToPlayer(Player* player)
 {
+    if (player->GetSession()->IsBotSession())
+        return;
+
     // send create update to player
     UpdateData upd(player->GetMapId());
     WorldPacket packet;
@@ -848,10 +855,7 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
 void Object::ClearUpdateMask(bool remove)
 {
     if (m_uint32Values)
-    {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
-            m_changedValues[index] = false;
-    }
+        memset(m_changedValues, 0, m_valuesCount);
 
     if (m_objectUpdated)
     {
@@ -861,23 +865,16 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-bool Object::LoadValues(const char* data)
+bool Object::LoadValues(Field const& data)
 {
     if (!m_uint32Values) _InitValues();
 
-    Tokens tokens = StrSplit(data, " ");
-
-    if (tokens.size() != m_valuesCount)
-        return false;
-
-    Tokens::iterator iter;
-    int index;
-    for (iter = tokens.begin(), index = 0; index < m_valuesCount; ++iter, ++index)
-    {
-        m_uint32Values[index] = std::stoul((*iter).c_str());
-    }
+    return UpdateFieldsBlob::Read(data, m_uint32Values, m_valuesCount);
+}
 
-    return true;
+void Object::SaveValues(std::string& data) const
+{
+    UpdateFieldsBlob::Write(m_uint32Values, m_valuesCount, data);
 }
 
 void Object::_SetUpdateBits(UpdateMask *updateMask, Player* target) const
@@ -2233,7 +2230,7 @@ struct WorldObjectChangeAccumulator
     {
         // send self fields changes in another way, otherwise
         // with new camera system when player's camera too far from player, camera wouldn't receive packets and changes from player
-        if (i_object.isType(TYPEMASK_PLAYER))
+        if (i_object.isType(TYPEMASK_PLAYER) && !((Player&)i_object).GetSession()->IsBotSession())
             i_object.BuildUpdateDataForPlayer((Player*)&i_object, i_updateDatas);
     }
 
@@ -2242,7 +2239,7 @@ struct WorldObjectChangeAccumulator
         for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
         {
             Player* owner = iter->getSource()->GetOwner();
-            if (owner != &i_object && owner->HasAtClient(&i_object))
+            if (owner != &i_object && owner->HasAtClient(&i_object) && !owner->GetSession()->IsBotSession())
                 i_object.BuildUpdateDataForPlayer(owner, i_updateDatas);
         }
     }
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "Util/ByteBuffer.h"
+#include "Util/ObjectPool.h"
 #include "Entities/UpdateFields.h"
 #include "Entities/UpdateData.h"
 #include "Entities/ObjectGuid.h"
@@ -93,6 +94,7 @@ struct MangosStringLocale;
 class Loot;
 struct ItemPrototype;
 class ChatHandler;
+class Field;
 struct SpellEntry;
 #ifdef BUILD_ELUNA
 class ElunaEventProcessor;
@@ -544,9 +546,13 @@ class Object
 
         void ClearUpdateMask(bool remove);
 
-        bool LoadValues(const char* data);
+        // update fields in the item_instance.data format, see UpdateFieldsBlob.h
+        bool LoadValues(Field const& data);
+        void SaveValues(std::string& data) const;
 
         uint16 GetValuesCount() const { return m_valuesCount; }
+        // uint32 words allocated for valuesCount update fields and their change flags
+        static size_t GetValuesBlockWords(uint16 valuesCount) { return valuesCount + (valuesCount + sizeof(uint32) - 1) / sizeof(uint32); }
 
         virtual bool HasQuest(uint32 /* quest_id */) const { return false; }
         virtual bool HasInvolvedQuest(uint32 /* quest_id */) const { return false; }
@@ -582,7 +588,7 @@ class Object
             float*  m_floatValues;
         };
 
-        std::vector<bool> m_changedValues;
+        uint8* m_changedValues;                             // one flag per value, kept behind the values in the same allocation
 
         uint16 m_valuesCount;
 
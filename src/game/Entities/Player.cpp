@@ -30,6 +30,7 @@
 #include "Quests/QuestDef.h"
 #include "Entities/GossipDef.h"
 #include "Entities/UpdateData.h"
+#include "Entities/UpdateFieldsBlob.h"
 #include "Chat/Channel.h"
 #include "Chat/ChannelMgr.h"
 #include "Maps/MapManager.h"
@@ -2786,6 +2787,9 @@ void Player::GiveLevel(uint32 level)
 
     SetLevel(level);
 
+    if (Guild* guild = sGuildMgr.GetGuildById(GetGuildId()))
+        guild->MemberStatsChanged(this);
+
     UpdateSkillsForLevel();
 
     // save base values (bonuses already included in stored stats
@@ -4644,6 +4648,8 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
                 delete resultFriend;
             }
 
+            sObjectMgr.RemoveCharacterIdentity(playerguid);
+
             CharacterDatabase.PExecute("DELETE FROM characters WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_account_data WHERE guid = '%u'", lowguid);
             CharacterDatabase.PExecute("DELETE FROM character_declinedname WHERE guid = '%u'", lowguid);
@@ -4683,6 +4689,7 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
         // The character gets unlinked from the account, the name gets freed up and appears as deleted ingame
         case 1:
             CharacterDatabase.PExecute("UPDATE characters SET deleteInfos_Name=name, deleteInfos_Account=account, deleteDate='" UI64FMTD "', name='', account=0 WHERE guid=%u", uint64(time(nullptr)), lowguid);
+            sObjectMgr.UnlinkCharacterIdentity(playerguid);
             break;
         default:
             sLog.outError("Player::DeleteFromDB: Unsupported delete method: %u.", charDelete_method);
@@ -7215,6 +7222,9 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
             Weather* wth = GetMap()->GetWeatherSystem()->FindOrCreateWeather(newZone);
             wth->SendWeatherUpdateToPlayer(this);
         }
+
+        if (Guild* guild = sGuildMgr.GetGuildById(GetGuildId()))
+            guild->MemberStatsChanged(this);
     }
 
     m_zoneUpdateId    = newZone;
@@ -7304,8 +7314,15 @@ void Player::CheckDuelDistance(time_t currTime)
         {
             duel->outOfBound = currTime;
 
-            WorldPacket data(SMSG_DUEL_OUTOFBOUNDS, 0);
-            GetSession()->SendPacket(data);
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+            if (m_playerbotAI)
+                m_playerbotAI->HandleBotEvent(PlayerbotEvent(BOT_EVENT_DUEL_OUT_OF_BOUNDS));
+            else
+#endif
+            {
+                WorldPacket data(SMSG_DUEL_OUTOFBOUNDS, 0);
+                GetSession()->SendPacket(data);
+            }
         }
     }
     else
@@ -7344,6 +7361,15 @@ void Player::DuelComplete(DuelCompleteType type)
         SendMessageToSet(data, true);
     }
 
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    Player* duelists[] = { this, duel->opponent };
+    for (Player* duelist : duelists)
+    {
+        if (PlayerbotAI* ai = duelist->GetPlayerbotAI())
+            ai->HandleBotEvent(PlayerbotEvent(BOT_EVENT_DUEL_COMPLETE));
+    }
+#endif
+
     if (type == DUEL_WON)
     {
         GetAchievementMgr().UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_LOSE_DUEL, 1);
@@ -15269,22 +15295,12 @@ bool Player::LoadPositionFromDB(ObjectGuid guid, uint32& mapid, float& x, float&
     return true;
 }
 
-void Player::_LoadIntoDataField(const char* data, uint32 startOffset, uint32 count)
+void Player::_LoadIntoDataField(Field const& data, uint32 startOffset, uint32 count)
 {
-    if (!data)
+    if (data.IsNULL())
         return;
 
-    Tokens tokens = StrSplit(data, " ");
-
-    if (tokens.size() != count)
-        return;
-
-    Tokens::iterator iter;
-    uint32 index;
-    for (iter = tokens.begin(), index = 0; index < count; ++iter, ++index)
-    {
-        m_uint32Values[startOffset + index] = std::stoul((*iter).c_str());
-    }
+    UpdateFieldsBlob::Read(data, &m_uint32Values[startOffset], count);
 }
 
 bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
@@ -15348,8 +15364,8 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
     SetUInt32Value(UNIT_FIELD_LEVEL, fields[6].GetUInt8());
     SetUInt32Value(PLAYER_XP, fields[7].GetUInt32());
 
-    _LoadIntoDataField(fields[54].GetString(), PLAYER_EXPLORED_ZONES_1, PLAYER_EXPLORED_ZONES_SIZE);
-    _LoadIntoDataField(fields[56].GetString(), PLAYER__FIELD_KNOWN_TITLES, KNOWN_TITLES_SIZE*2);
+    _LoadIntoDataField(fields[54], PLAYER_EXPLORED_ZONES_1, PLAYER_EXPLORED_ZONES_SIZE);
+    _LoadIntoDataField(fields[56], PLAYER__FIELD_KNOWN_TITLES, KNOWN_TITLES_SIZE*2);
 
     InitDisplayIds();                                       // model, scale and model data
 
@@ -17257,11 +17273,9 @@ void Player::SaveToDB()
     uberInsert.addUInt32(uint32(m_specsCount));
     uberInsert.addUInt32(uint32(m_activeSpec));
 
-    for (uint32 i = 0; i < PLAYER_EXPLORED_ZONES_SIZE; ++i) // string
-    {
-        ss << GetUInt32Value(PLAYER_EXPLORED_ZONES_1 + i) << " ";
-    }
-    uberInsert.addString(ss);
+    std::string fieldsData;
+    UpdateFieldsBlob::Write(&m_uint32Values[PLAYER_EXPLORED_ZONES_1], PLAYER_EXPLORED_ZONES_SIZE, fieldsData);
+    uberInsert.addBinary(fieldsData);
 
     for (uint32 i = 0; i < EQUIPMENT_SLOT_END * 2; ++i)     // string
     {
@@ -17269,11 +17283,8 @@ void Player::SaveToDB()
     }
     uberInsert.addString(ss);
 
-    for(uint32 i = 0; i < KNOWN_TITLES_SIZE*2; ++i )                //string
-    {
-        ss << GetUInt32Value(PLAYER__FIELD_KNOWN_TITLES + i) << " ";
-    }
-    uberInsert.addString(ss);
+    UpdateFieldsBlob::Write(&m_uint32Values[PLAYER__FIELD_KNOWN_TITLES], KNOWN_TITLES_SIZE * 2, fieldsData);
+    uberInsert.addBinary(fieldsData);
 
     uberInsert.addUInt32(uint32(GetByteValue(PLAYER_FIELD_BYTES, 2)));
 
@@ -17680,52 +17691,58 @@ void Player::_SaveQuestStatus()
 
     static SqlStatementID updateQuestStatus ;
 
-    // we don't need transactions here.
-    for (QuestStatusMap::iterator i = mQuestStatus.begin(); i != mQuestStatus.end(); ++i)
+    // new rows are written in their own pass so the INSERTs are merged into multi-row INSERTs
+    for (int pass = 0; pass < 2; ++pass)
     {
-        QuestStatusData& questStatus = i->second;
-        switch (questStatus.uState)
+        for (QuestStatusMap::iterator i = mQuestStatus.begin(); i != mQuestStatus.end(); ++i)
         {
-            case QUEST_NEW :
+            QuestStatusData& questStatus = i->second;
+            if ((questStatus.uState == QUEST_NEW) != (pass == 0))
+                continue;
+
+            switch (questStatus.uState)
             {
-                SqlStatement stmt = CharacterDatabase.CreateStatement(insertQuestStatus, "INSERT INTO character_queststatus (guid,quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4,itemcount5,itemcount6) "
-                                    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+                case QUEST_NEW :
+                {
+                    SqlStatement stmt = CharacterDatabase.CreateStatement(insertQuestStatus, "INSERT INTO character_queststatus (guid,quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4,itemcount5,itemcount6) "
+                                        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
 
-                stmt.addUInt32(GetGUIDLow());
-                stmt.addUInt32(i->first);
-                stmt.addUInt8(questStatus.m_status);
-                stmt.addUInt8(questStatus.m_rewarded);
-                stmt.addUInt8(questStatus.m_explored);
-                stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
-                for (int k = 0; k < QUEST_OBJECTIVES_COUNT; ++k)
-                    stmt.addUInt32(questStatus.m_creatureOrGOcount[k]);
-                for (int k = 0; k < QUEST_ITEM_OBJECTIVES_COUNT; ++k)
-                    stmt.addUInt32(questStatus.m_itemcount[k]);
-                stmt.Execute();
-            }
-            break;
-            case QUEST_CHANGED :
-            {
-                SqlStatement stmt = CharacterDatabase.CreateStatement(updateQuestStatus, "UPDATE character_queststatus SET status = ?,rewarded = ?,explored = ?,timer = ?,"
-                                    "mobcount1 = ?,mobcount2 = ?,mobcount3 = ?,mobcount4 = ?,itemcount1 = ?,itemcount2 = ?,itemcount3 = ?,itemcount4 = ?,itemcount5 = ?,itemcount6 = ? WHERE guid = ? AND quest = ?");
-
-                stmt.addUInt8(questStatus.m_status);
-                stmt.addUInt8(questStatus.m_rewarded);
-                stmt.addUInt8(questStatus.m_explored);
-                stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
-                for (int k = 0; k < QUEST_OBJECTIVES_COUNT; ++k)
-                    stmt.addUInt32(questStatus.m_creatureOrGOcount[k]);
-                for (int k = 0; k < QUEST_ITEM_OBJECTIVES_COUNT; ++k)
-                    stmt.addUInt32(questStatus.m_itemcount[k]);
-                stmt.addUInt32(GetGUIDLow());
-                stmt.addUInt32(i->first);
-                stmt.Execute();
-            }
-            break;
-            case QUEST_UNCHANGED:
+                    stmt.addUInt32(GetGUIDLow());
+                    stmt.addUInt32(i->first);
+                    stmt.addUInt8(questStatus.m_status);
+                    stmt.addUInt8(questStatus.m_rewarded);
+                    stmt.addUInt8(questStatus.m_explored);
+                    stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
+                    for (int k = 0; k < QUEST_OBJECTIVES_COUNT; ++k)
+                        stmt.addUInt32(questStatus.m_creatureOrGOcount[k]);
+                    for (int k = 0; k < QUEST_ITEM_OBJECTIVES_COUNT; ++k)
+                        stmt.addUInt32(questStatus.m_itemcount[k]);
+                    stmt.Execute();
+                }
                 break;
-        };
-        questStatus.uState = QUEST_UNCHANGED;
+                case QUEST_CHANGED :
+                {
+                    SqlStatement stmt = CharacterDatabase.CreateStatement(updateQuestStatus, "UPDATE character_queststatus SET status = ?,rewarded = ?,explored = ?,timer = ?,"
+                                        "mobcount1 = ?,mobcount2 = ?,mobcount3 = ?,mobcount4 = ?,itemcount1 = ?,itemcount2 = ?,itemcount3 = ?,itemcount4 = ?,itemcount5 = ?,itemcount6 = ? WHERE guid = ? AND quest = ?");
+
+                    stmt.addUInt8(questStatus.m_status);
+                    stmt.addUInt8(questStatus.m_rewarded);
+                    stmt.addUInt8(questStatus.m_explored);
+                    stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
+                    for (int k = 0; k < QUEST_OBJECTIVES_COUNT; ++k)
+                        stmt.addUInt32(questStatus.m_creatureOrGOcount[k]);
+                    for (int k = 0; k < QUEST_ITEM_OBJECTIVES_COUNT; ++k)
+                        stmt.addUInt32(questStatus.m_itemcount[k]);
+                    stmt.addUInt32(GetGUIDLow());
+                    stmt.addUInt32(i->first);
+                    stmt.Execute();
+                }
+                break;
+                case QUEST_UNCHANGED:
+                    break;
+            };
+            questStatus.uState = QUEST_UNCHANGED;
+        }
     }
 }
 
@@ -17858,16 +17875,23 @@ void Player::_SaveSpells()
     SqlStatement stmtDel = CharacterDatabase.CreateStatement(delSpells, "DELETE FROM character_spell WHERE guid = ? and spell = ?");
     SqlStatement stmtIns = CharacterDatabase.CreateStatement(insSpells, "INSERT INTO character_spell (guid,spell,active,disabled) VALUES (?, ?, ?, ?)");
 
-    for (PlayerSpellMap::iterator itr = m_spells.begin(), next = m_spells.begin(); itr != m_spells.end();)
+    // all deletes go first so the inserts below stay consecutive and are merged into multi-row INSERTs
+    for (PlayerSpellMap::const_iterator itr = m_spells.begin(); itr != m_spells.end(); ++itr)
+    {
+        if (itr->second.state != PLAYERSPELL_REMOVED && itr->second.state != PLAYERSPELL_CHANGED)
+            continue;
+
+        if (!GetTalentSpellCost(itr->first))
+            stmtDel.PExecute(GetGUIDLow(), itr->first);
+    }
+
+    for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
     {
         uint32 talentCosts = GetTalentSpellCost(itr->first);
         PlayerSpell& playerSpell = itr->second;
 
         if (!talentCosts)
         {
-            if (playerSpell.state == PLAYERSPELL_REMOVED || playerSpell.state == PLAYERSPELL_CHANGED)
-                stmtDel.PExecute(GetGUIDLow(), itr->first);
-
             // add only changed/new not dependent spells
             if (!playerSpell.dependent && (playerSpell.state == PLAYERSPELL_NEW || playerSpell.state == PLAYERSPELL_CHANGED))
                 stmtIns.PExecute(GetGUIDLow(), itr->first, uint8(playerSpell.active ? 1 : 0), uint8(playerSpell.disabled ? 1 : 0));
@@ -18061,6 +18085,7 @@ void Player::Customize(ObjectGuid guid, uint8 gender, uint8 skin, uint8 face, ui
     player_bytes2 |= facialHair;
 
     CharacterDatabase.PExecute("UPDATE characters SET gender = '%u', playerBytes = '%u', playerBytes2 = '%u' WHERE guid = '%u'", gender, skin | (face << 8) | (hairStyle << 16) | (hairColor << 24), player_bytes2, guid.GetCounter());
+    sObjectMgr.UpdateCharacterIdentityGender(guid, gender);
 
     delete result;
 }
@@ -18297,8 +18322,20 @@ void Player::Whisper(const std::string& text, uint32 language, ObjectGuid receiv
     Player* rPlayer = sObjectMgr.GetPlayer(receiver);
 
     WorldPacket data;
-    ChatHandler::BuildChatPacket(data, CHAT_MSG_WHISPER, text.c_str(), Language(language), GetChatTag(), GetObjectGuid(), GetName());
-    rPlayer->GetSession()->SendPacket(data);
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    if (PlayerbotAI* ai = rPlayer->GetPlayerbotAI())
+    {
+        PlayerbotEvent event(BOT_EVENT_CHAT, GetObjectGuid(), CHAT_MSG_WHISPER);
+        event.value2 = language;
+        event.text = text;
+        ai->HandleBotEvent(event);
+    }
+    else
+#endif
+    {
+        ChatHandler::BuildChatPacket(data, CHAT_MSG_WHISPER, text.c_str(), Language(language), GetChatTag(), GetObjectGuid(), GetName());
+        rPlayer->GetSession()->SendPacket(data);
+    }
 
     // do not send confirmations, afk, dnd or system notifications for addon messages
     if (language == LANG_ADDON)
@@ -20023,7 +20060,8 @@ void Player::UpdateVisibilityOf(WorldObject const* viewPoint, T* target, UpdateD
         if (target->isVisibleForInState(this, viewPoint, false))
         {
             visibleNow.insert(target);
-            target->BuildCreateUpdateBlockForPlayer(&data, this);
+            if (!GetSession()->IsBotSession())
+                target->BuildCreateUpdateBlockForPlayer(&data, this);
             AddAtClient(target);
 
             DEBUG_FILTER_LOG(LOG_FILTER_VISIBILITY_CHANGES, "UpdateVisibilityOf(TemplateV): %s is visible now for %s. Distance = %f", target->GetGuidStr().c_str(), GetGuidStr().c_str(), GetDistance(target));
@@ -29,6 +29,7 @@
 #include "Entities/ObjectGuid.h"
 #include "Entities/Player.h"
 #include "Entities/NPCHandler.h"
+#include "Entities/QueryResponseCache.h"
 #include "Server/SQLStorages.h"
 
 void WorldSession::SendNameQueryOpcode(Player* p)
@@ -56,51 +57,25 @@ void WorldSession::SendNameQueryOpcode(Player* p)
     SendPacket(data);
 }
 
-void WorldSession::SendNameQueryOpcodeFromDB(ObjectGuid guid)
+void WorldSession::SendNameQueryOpcodeFromCache(ObjectGuid guid)
 {
-    CharacterDatabase.AsyncPQuery(&WorldSession::SendNameQueryOpcodeFromDBCallBack, GetAccountId(),
-                                  !sWorld.getConfig(CONFIG_BOOL_DECLINED_NAMES_USED) ?
-                                  //   ------- Query Without Declined Names --------
-                                  //          0     1     2     3       4
-                                  "SELECT guid, name, race, gender, class "
-                                  "FROM characters WHERE guid = '%u'"
-                                  :
-                                  //   --------- Query With Declined Names ---------
-                                  //          0                1     2     3       4
-                                  "SELECT characters.guid, name, race, gender, class, "
-                                  //   5         6       7           8             9
-                                  "genitive, dative, accusative, instrumental, prepositional "
-                                  "FROM characters LEFT JOIN character_declinedname ON characters.guid = character_declinedname.guid WHERE characters.guid = '%u'",
-                                  guid.GetCounter());
-}
-
-void WorldSession::SendNameQueryOpcodeFromDBCallBack(QueryResult* result, uint32 accountId)
-{
-    if (!result)
+    CharacterIdentity identity;
+    if (!sObjectMgr.GetCharacterIdentity(guid, identity))
         return;
 
-    WorldSession* session = sWorld.FindSession(accountId);
-    if (!session)
-    {
-        delete result;
-        return;
-    }
-
-    Field* fields = result->Fetch();
-    uint32 lowguid      = fields[0].GetUInt32();
-    std::string name = fields[1].GetCppString();
+    std::string name = identity.name;
     uint8 pRace = 0, pGender = 0, pClass = 0;
     if (name.empty())
-        name         = session->GetMangosString(LANG_NON_EXIST_CHARACTER);
+        name         = GetMangosString(LANG_NON_EXIST_CHARACTER);
     else
     {
-        pRace        = fields[2].GetUInt8();
-        pGender      = fields[3].GetUInt8();
-        pClass       = fields[4].GetUInt8();
+        pRace        = identity.race;
+        pGender      = identity.gender;
+        pClass       = identity.class_;
     }
     // guess size
     WorldPacket data(SMSG_NAME_QUERY_RESPONSE, (8 + 1 + 1 + 1 + 1 + 1 + 1 + 10));
-    data << ObjectGuid(HIGHGUID_PLAYER, lowguid).WriteAsPacked();
+    data << guid.WriteAsPacked();
     data << uint8(0);                                       // added in 3.1; if > 1, then end of packet
     data << name;
     data << uint8(0);                                       // realm name for cross realm BG usage
@@ -108,18 +83,16 @@ void WorldSession::SendNameQueryOpcodeFromDBCallBack(QueryResult* result, uint32
     data << uint8(pGender);                                 // gender
     data << uint8(pClass);                                  // class
 
-    // if the first declined name field (5) is empty, the rest must be too
-    if (sWorld.getConfig(CONFIG_BOOL_DECLINED_NAMES_USED) && !fields[5].GetCppString().empty())
+    if (sWorld.getConfig(CONFIG_BOOL_DECLINED_NAMES_USED) && identity.declinedNames)
     {
         data << uint8(1);                                   // is declined
-        for (int i = 5; i < MAX_DECLINED_NAME_CASES + 5; ++i)
-            data << fields[i].GetCppString();
+        for (int i = 0; i < MAX_DECLINED_NAME_CASES; ++i)
+            data << identity.declinedNames->name[i];
     }
     else
         data << uint8(0);                                   // is not declined
 
-    session->SendPacket(data);
-    delete result;
+    SendPacket(data);
 }
 
 void WorldSession::HandleNameQueryOpcode(WorldPacket& recv_data)
@@ -133,7 +106,7 @@ void WorldSession::HandleNameQueryOpcode(WorldPacket& recv_data)
     if (pChar)
         SendNameQueryOpcode(pChar);
     else
-        SendNameQueryOpcodeFromDB(guid);
+        SendNameQueryOpcodeFromCache(guid);
 }
 
 void WorldSession::HandleQueryTimeOpcode(WorldPacket& /*recv_data*/)
@@ -154,6 +127,12 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recv_data)
     {
         int loc_idx = GetSessionDbLocaleIndex();
 
+        if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_CREATURE, entry, loc_idx))
+        {
+            SendPacket(*response);
+            return;
+        }
+
         char const* name = ci->Name;
         char const* subName = ci->SubName;
         sObjectMgr.GetCreatureLocaleStrings(entry, loc_idx, &name, &subName);
@@ -187,6 +166,7 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recv_data)
             data << uint32(ci->QuestItems[i]);              // itemId[6], quest drop
         data << uint32(ci->MovementTemplateId);             // CreatureMovementInfo.dbc
         data << uint32(0);                                  //unk
+        sQueryResponseCache.Insert(QUERY_RESPONSE_CREATURE, entry, loc_idx, data);
         SendPacket(data);
         DEBUG_LOG("WORLD: Sent SMSG_CREATURE_QUERY_RESPONSE");
     }
@@ -212,6 +192,14 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recv_data)
     const GameObjectInfo* info = ObjectMgr::GetGameObjectInfo(entryID);
     if (info)
     {
+        int loc_idx = GetSessionDbLocaleIndex();
+
+        if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_GAMEOBJECT, entryID, loc_idx))
+        {
+            SendPacket(*response);
+            return;
+        }
+
         std::string Name;
         std::string IconName;
         std::string CastBarCaption;
@@ -220,7 +208,6 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recv_data)
         IconName = info->IconName;
         CastBarCaption = info->castBarCaption;
 
-        int loc_idx = GetSessionDbLocaleIndex();
         if (loc_idx >= 0)
         {
             GameObjectLocale const* gl = sObjectMgr.GetGameObjectLocale(entryID);
@@ -246,6 +233,7 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recv_data)
         data << float(info->size);                          // go size
         for (uint32 i = 0; i < 6; ++i)
             data << uint32(info->questItems[i]);            // itemId[6], quest drop
+        sQueryResponseCache.Insert(QUERY_RESPONSE_GAMEOBJECT, entryID, loc_idx, data);
         SendPacket(data);
         DEBUG_LOG("WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
@@ -323,6 +311,17 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recv_data)
 
     GossipText const* pGossip = sObjectMgr.GetGossipText(textID);
 
+    int loc_idx = GetSessionDbLocaleIndex();
+
+    if (pGossip)
+    {
+        if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_NPC_TEXT, textID, loc_idx))
+        {
+            SendPacket(*response);
+            return;
+        }
+    }
+
     WorldPacket data(SMSG_NPC_TEXT_UPDATE, 100);            // guess size
     data << textID;
 
@@ -351,8 +350,6 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recv_data)
             Text_1[i] = pGossip->Options[i].Text_1;
         }
 
-        int loc_idx = GetSessionDbLocaleIndex();
-
         sObjectMgr.GetNpcTextLocaleStringsAll(textID, loc_idx, &Text_0, &Text_1);
 
         for (int i = 0; i < MAX_GOSSIP_TEXT_OPTIONS; ++i)
@@ -377,6 +374,8 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recv_data)
                 data << pGossip->Options[i].Emotes[j]._Emote;
             }
         }
+
+        sQueryResponseCache.Insert(QUERY_RESPONSE_NPC_TEXT, textID, loc_idx, data);
     }
 
     SendPacket(data);
@@ -393,9 +392,21 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recv_data)
     recv_data >> pageID;
     recv_data.read_skip<uint64>();                          // guid
 
+    int loc_idx = GetSessionDbLocaleIndex();
+
     while (pageID)
     {
         PageText const* pPage = sPageTextStore.LookupEntry<PageText>(pageID);
+        if (pPage)
+        {
+            if (QueryResponseCache::ResponsePtr response = sQueryResponseCache.Find(QUERY_RESPONSE_PAGE_TEXT, pageID, loc_idx))
+            {
+                SendPacket(*response);
+                pageID = pPage->Next_Page;
+                continue;
+            }
+        }
+
         // guess size
         WorldPacket data(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
         data << pageID;
@@ -410,7 +421,6 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recv_data)
         {
             std::string Text = pPage->Text;
 
-            int loc_idx = GetSessionDbLocaleIndex();
             if (loc_idx >= 0)
             {
                 PageTextLocale const* pl = sObjectMgr.GetPageTextLocale(pageID);
@@ -423,6 +433,7 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recv_data)
 
             data << Text;
             data << uint32(pPage->Next_Page);
+            sQueryResponseCache.Insert(QUERY_RESPONSE_PAGE_TEXT, pageID, loc_idx, data);
             pageID = pPage->Next_Page;
         }
         SendPacket(data);
@@ -0,0 +1,47 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "Entities/QueryResponseCache.h"
+#include "Policies/Singleton.h"
+
+INSTANTIATE_SINGLETON_1(QueryResponseCache);
+
+QueryResponseCache::ResponsePtr QueryResponseCache::Find(QueryResponseType type, uint32 entry, int locale) const
+{
+    std::lock_guard<std::mutex> guard(m_locks[type]);
+
+    ResponseMap::const_iterator itr = m_responses[type].find(MakeKey(entry, locale));
+    return itr != m_responses[type].end() ? itr->second : nullptr;
+}
+
+void QueryResponseCache::Insert(QueryResponseType type, uint32 entry, int locale, WorldPacket const& packet)
+{
+    ResponsePtr response = std::make_shared<WorldPacket const>(packet);
+
+    std::lock_guard<std::mutex> guard(m_locks[type]);
+    m_responses[type][MakeKey(entry, locale)] = std::move(response);
+}
+
+void QueryResponseCache::Invalidate(QueryResponseType type)
+{
+    ResponseMap responses;                                  // released outside of lock
+
+    std::lock_guard<std::mutex> guard(m_locks[type]);
+    m_responses[type].swap(responses);
+}
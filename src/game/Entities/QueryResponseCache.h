@@ -0,0 +1,74 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef MANGOS_QUERY_RESPONSE_CACHE_H
+#define MANGOS_QUERY_RESPONSE_CACHE_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+#include "Server/WorldPacket.h"
+
+#include <memory>
+#include <mutex>
+
+enum QueryResponseType
+{
+    QUERY_RESPONSE_CREATURE         = 0,                    // SMSG_CREATURE_QUERY_RESPONSE
+    QUERY_RESPONSE_GAMEOBJECT       = 1,                    // SMSG_GAMEOBJECT_QUERY_RESPONSE
+    QUERY_RESPONSE_NPC_TEXT         = 2,                    // SMSG_NPC_TEXT_UPDATE
+    QUERY_RESPONSE_PAGE_TEXT        = 3,                    // SMSG_PAGE_TEXT_QUERY_RESPONSE
+    QUERY_RESPONSE_QUEST            = 4,                    // SMSG_QUEST_QUERY_RESPONSE
+    QUERY_RESPONSE_ITEM             = 5,                    // SMSG_DB_REPLY for Item.db2
+    QUERY_RESPONSE_ITEM_SPARSE      = 6,                    // SMSG_DB_REPLY for Item-sparse.db2
+};
+
+#define MAX_QUERY_RESPONSE_TYPE       7
+
+/**
+ * Finished static query response packets, keyed by entry and session DB locale index.
+ *
+ * Responses only depend on template and locale data, so a packet built once is sent
+ * as is to every later client asking for the same entry. Only responses for existing
+ * entries are stored, so clients can't grow the cache with made up ids.
+ * Stored packets are never modified, the reload commands drop them by type instead.
+ */
+class QueryResponseCache
+{
+    public:
+        typedef std::shared_ptr<WorldPacket const> ResponsePtr;
+
+        /// Returns cached response or nullptr. Safe to call from map threads.
+        ResponsePtr Find(QueryResponseType type, uint32 entry, int locale) const;
+        /// Stores copy of a built response. Safe to call from map threads.
+        void Insert(QueryResponseType type, uint32 entry, int locale, WorldPacket const& packet);
+        /// Drops all responses of type, must be called after related data reload.
+        void Invalidate(QueryResponseType type);
+
+    private:
+        typedef std::unordered_map<uint64 /*entry|locale*/, ResponsePtr> ResponseMap;
+
+        static uint64 MakeKey(uint32 entry, int locale) { return (uint64(entry) << 32) | uint32(locale + 1); }
+
+        ResponseMap         m_responses[MAX_QUERY_RESPONSE_TYPE];
+        mutable std::mutex  m_locks[MAX_QUERY_RESPONSE_TYPE];
+};
+
+#define sQueryResponseCache MaNGOS::Singleton<QueryResponseCache>::Instance()
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Entities/UpdateFieldsBlob.h"
+#include "Database/Field.h"
+#include "Util/ByteConverter.h"
+
+namespace
+{
+    uint32 GetBinaryCount(char const* data)
+    {
+        return uint8(data[2]) | (uint32(uint8(data[3])) << 8);
+    }
+
+    // parse space separated decimal text of at most maxCount values, returns the value count or -1 on broken data
+    int32 ParseText(char const* data, size_t length, uint32* values, uint32 maxCount)
+    {
+        char const* end = data + length;
+        uint32 count = 0;
+        while (data != end)
+        {
+            if (*data == ' ')
+            {
+                ++data;
+                continue;
+            }
+
+            if (*data < '0' || *data > '9' || count == maxCount)
+                return -1;
+
+            uint64 value = 0;
+            for (; data != end && *data >= '0' && *data <= '9'; ++data)
+                value = value * 10 + (*data - '0');
+
+            if (value > 0xFFFFFFFF)
+                return -1;
+
+            values[count++] = uint32(value);
+        }
+
+        return count;
+    }
+}
+
+void UpdateFieldsBlob::Write(uint32 const* values, uint32 count, std::string& out)
+{
+#ifdef DO_POSTGRESQL
+    WriteText(values, count, out);
+#else
+    MANGOS_ASSERT(count <= 0xFFFF);
+
+    out.resize(UPDATE_FIELDS_BLOB_HEADER_SIZE + count * sizeof(uint32));
+    out[0] = char(UPDATE_FIELDS_BLOB_MAGIC);
+    out[1] = char(UPDATE_FIELDS_BLOB_VERSION);
+    out[2] = char(count & 0xFF);
+    out[3] = char(count >> 8);
+
+    char* dest = &out[UPDATE_FIELDS_BLOB_HEADER_SIZE];
+#if MANGOS_ENDIAN == MANGOS_BIG_ENDIAN
+    for (uint32 i = 0; i < count; ++i)
+    {
+        uint32 value = values[i];
+        EndianConvert(value);
+        memcpy(dest + i * sizeof(uint32), &value, sizeof(uint32));
+    }
+#else
+    memcpy(dest, values, count * sizeof(uint32));
+#endif
+#endif
+}
+
+void UpdateFieldsBlob::WriteText(uint32 const* values, uint32 count, std::string& out)
+{
+    out.clear();
+    out.reserve(count * 4);
+
+    char buf[12];
+    for (uint32 i = 0; i < count; ++i)
+    {
+        int len = snprintf(buf, sizeof(buf), "%u ", values[i]);
+        out.append(buf, len);
+    }
+}
+
+bool UpdateFieldsBlob::IsBinary(Field const& field)
+{
+    if (field.GetLength() < UPDATE_FIELDS_BLOB_HEADER_SIZE)
+        return false;
+
+    char const* data = field.GetString();
+    return uint8(data[0]) == UPDATE_FIELDS_BLOB_MAGIC && uint8(data[1]) == UPDATE_FIELDS_BLOB_VERSION &&
+           field.GetLength() == UPDATE_FIELDS_BLOB_HEADER_SIZE + GetBinaryCount(data) * sizeof(uint32);
+}
+
+bool UpdateFieldsBlob::Read(Field const& field, uint32* values, uint32 count)
+{
+    char const* data = field.GetString();
+
+    if (IsBinary(field))
+    {
+        if (GetBinaryCount(data) != count)
+            return false;
+
+        memcpy(values, data + UPDATE_FIELDS_BLOB_HEADER_SIZE, count * sizeof(uint32));
+#if MANGOS_ENDIAN == MANGOS_BIG_ENDIAN
+        for (uint32 i = 0; i < count; ++i)
+            EndianConvert(values[i]);
+#endif
+        return true;
+    }
+
+    // text rows are parsed into a copy so broken data doesn't leave the array half written
+    std::vector<uint32> parsed(count);
+    if (ParseText(data, field.GetLength(), parsed.data(), count) != int32(count))
+        return false;
+
+    memcpy(values, parsed.data(), count * sizeof(uint32));
+    return true;
+}
+
+bool UpdateFieldsBlob::Read(Field const& field, std::vector<uint32>& values)
+{
+    char const* data = field.GetString();
+
+    if (IsBinary(field))
+    {
+        values.resize(GetBinaryCount(data));
+        return Read(field, values.data(), values.size());
+    }
+
+    // every value takes at least 2 characters with its separator
+    values.resize(field.GetLength() / 2 + 1);
+    int32 count = ParseText(data, field.GetLength(), values.data(), values.size());
+    if (count < 0)
+        return false;
+
+    values.resize(count);
+    return true;
+}
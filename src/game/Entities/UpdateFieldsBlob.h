@@ -0,0 +1,60 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_UPDATEFIELDSBLOB_H
+#define MANGOS_UPDATEFIELDSBLOB_H
+
+#include "Common.h"
+
+class Field;
+
+/*
+ * Storage of update field arrays (item_instance.data, characters.exploredZones and
+ * characters.knownTitles) in the character database.
+ *
+ * Version 1 is a 4 byte header followed by the values as little endian uint32,
+ * so on load they are copied straight into the update field array:
+ *     uint8  UPDATE_FIELDS_BLOB_MAGIC
+ *     uint8  UPDATE_FIELDS_BLOB_VERSION
+ *     uint16 value count
+ *
+ * Rows written before the binary format hold space separated decimal text. Both
+ * formats are accepted on load, CharacterDatabaseCleaner converts old rows in bulk.
+ */
+
+#define UPDATE_FIELDS_BLOB_MAGIC        0xFE
+#define UPDATE_FIELDS_BLOB_VERSION      1
+#define UPDATE_FIELDS_BLOB_HEADER_SIZE  4
+
+namespace UpdateFieldsBlob
+{
+    // serialize count values in the current format (text on PostgreSQL)
+    void Write(uint32 const* values, uint32 count, std::string& out);
+    // serialize count values as space separated decimal text
+    void WriteText(uint32 const* values, uint32 count, std::string& out);
+
+    // fill exactly count values from a field in either format, false if the stored value count differs
+    bool Read(Field const& field, uint32* values, uint32 count);
+    // read all values from a field in either format
+    bool Read(Field const& field, std::vector<uint32>& values);
+
+    // true if the field holds the binary format
+    bool IsBinary(Field const& field);
+}
+
+#endif
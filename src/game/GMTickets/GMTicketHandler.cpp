@@ -134,12 +134,11 @@ void WorldSession::HandleGMTicketCreateOpcode(WorldPacket& recv_data)
     data << uint32(2);                                      // 2 - nothing appears (3-error creating, 5-error updating)
     SendPacket(data);
 
-    // TODO: Guard player map
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::const_iterator itr = m.begin(); itr != m.end(); ++itr)
+    HashMapHolder<Player>::SnapshotType players = sObjectAccessor.GetPlayersSnapshot();
+    for (HashMapHolder<Player>::SnapshotType::const_iterator itr = players.begin(); itr != players.end(); ++itr)
     {
-        if (itr->second->GetSession()->GetSecurity() >= SEC_GAMEMASTER && itr->second->isAcceptTickets())
-            ChatHandler(itr->second).PSendSysMessage(LANG_COMMAND_TICKETNEW, GetPlayer()->GetName());
+        if ((*itr)->GetSession()->GetSecurity() >= SEC_GAMEMASTER && (*itr)->isAcceptTickets())
+            ChatHandler(*itr).PSendSysMessage(LANG_COMMAND_TICKETNEW, GetPlayer()->GetName());
     }
 }
 
@@ -95,10 +95,9 @@ Player* ObjectAccessor::FindPlayerByName(char const* name, bool inWorld /*=true*
 void
 ObjectAccessor::SaveAllPlayers()
 {
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        itr->second->SaveToDB();
+    HashMapHolder<Player>::SnapshotType players = GetPlayersSnapshot();
+    for (HashMapHolder<Player>::SnapshotType::const_iterator itr = players.begin(); itr != players.end(); ++itr)
+        (*itr)->SaveToDB();
 }
 
 void ObjectAccessor::KickPlayer(ObjectGuid guid)
@@ -279,7 +278,7 @@ void ObjectAccessor::RemoveObject(Player* player)
 
 /// Define the static member of HashMapHolder
 
-template <class T> typename HashMapHolder<T>::MapType HashMapHolder<T>::m_objectMap;
+template <class T> typename HashMapHolder<T>::Shard HashMapHolder<T>::m_shards[HashMapHolder<T>::SHARD_COUNT];
 template <class T> std::mutex HashMapHolder<T>::i_lock;
 
 /// Global definitions for the hashmap storage
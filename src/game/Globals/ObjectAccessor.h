@@ -31,52 +31,118 @@
 #include "Entities/Player.h"
 #include "Entities/Corpse.h"
 
+#include <memory>
 #include <mutex>
 
 class Unit;
 class WorldObject;
 class Map;
 
+// Objects are spread over shards and, within a shard, over buckets by guid. Every bucket publishes an
+// immutable map that writers replace as a whole (copy on write), so lookups never take a lock and never
+// wait for a writer. An insert or remove copies one bucket, about 1/1024 of the objects.
 template <class T>
 class HashMapHolder
 {
     public:
 
         typedef std::unordered_map<ObjectGuid, T*>   MapType;
+        typedef std::vector<T*>                      SnapshotType;
+
+        // kept for scripts built against the old single map API (e.g. Eluna), the snapshots need no lock
         typedef std::mutex LockType;
         typedef std::lock_guard<std::mutex> ReadGuard;
-        typedef std::lock_guard<std::mutex> WriteGuard;
 
         static void Insert(T* o)
         {
-            WriteGuard guard(i_lock);
-            m_objectMap[o->GetObjectGuid()] = o;
+            Shard& shard = GetShard(o->GetObjectGuid());
+            std::shared_ptr<MapType const>& bucket = shard.GetBucket(o->GetObjectGuid());
+            std::lock_guard<std::mutex> guard(shard.writeLock);
+            std::shared_ptr<MapType> objects = std::make_shared<MapType>(*std::atomic_load(&bucket));
+            (*objects)[o->GetObjectGuid()] = o;
+            std::atomic_store(&bucket, std::shared_ptr<MapType const>(std::move(objects)));
         }
 
         static void Remove(T* o)
         {
-            WriteGuard guard(i_lock);
-            m_objectMap.erase(o->GetObjectGuid());
+            Shard& shard = GetShard(o->GetObjectGuid());
+            std::shared_ptr<MapType const>& bucket = shard.GetBucket(o->GetObjectGuid());
+            std::lock_guard<std::mutex> guard(shard.writeLock);
+            std::shared_ptr<MapType> objects = std::make_shared<MapType>(*std::atomic_load(&bucket));
+            objects->erase(o->GetObjectGuid());
+            std::atomic_store(&bucket, std::shared_ptr<MapType const>(std::move(objects)));
         }
 
         static T* Find(ObjectGuid guid)
         {
-            ReadGuard guard(i_lock);
-            typename MapType::iterator itr = m_objectMap.find(guid);
-            return (itr != m_objectMap.end()) ? itr->second : nullptr;
+            std::shared_ptr<MapType const> objects = std::atomic_load(&GetShard(guid).GetBucket(guid));
+            typename MapType::const_iterator itr = objects->find(guid);
+            return (itr != objects->end()) ? itr->second : nullptr;
+        }
+
+        // all objects held at the time of the call, later inserts and removes don't affect the result
+        static SnapshotType GetSnapshot()
+        {
+            SnapshotType snapshot;
+            for (uint32 i = 0; i < SHARD_COUNT; ++i)
+            {
+                for (uint32 j = 0; j < BUCKET_COUNT; ++j)
+                {
+                    std::shared_ptr<MapType const> objects = std::atomic_load(&m_shards[i].buckets[j]);
+                    for (typename MapType::const_iterator itr = objects->begin(); itr != objects->end(); ++itr)
+                        snapshot.push_back(itr->second);
+                }
+            }
+
+            return snapshot;
         }
 
-        static MapType& GetContainer() { return m_objectMap; }
+        // same as GetSnapshot() keyed by guid, for callers of the former container access
+        static MapType GetContainer()
+        {
+            MapType container;
+            for (uint32 i = 0; i < SHARD_COUNT; ++i)
+            {
+                for (uint32 j = 0; j < BUCKET_COUNT; ++j)
+                {
+                    std::shared_ptr<MapType const> objects = std::atomic_load(&m_shards[i].buckets[j]);
+                    container.insert(objects->begin(), objects->end());
+                }
+            }
+
+            return container;
+        }
 
         static LockType& GetLock() { return i_lock; }
 
     private:
 
+        static uint32 const SHARD_COUNT = 16;
+        static uint32 const BUCKET_COUNT = 64;
+
+        struct Shard
+        {
+            Shard()
+            {
+                // all buckets start with the same empty map
+                std::shared_ptr<MapType const> empty = std::make_shared<MapType const>();
+                for (uint32 i = 0; i < BUCKET_COUNT; ++i)
+                    buckets[i] = empty;
+            }
+
+            std::shared_ptr<MapType const>& GetBucket(ObjectGuid guid) { return buckets[std::hash<ObjectGuid>()(guid) / SHARD_COUNT % BUCKET_COUNT]; }
+
+            std::mutex writeLock;                           // serializes writers only
+            std::shared_ptr<MapType const> buckets[BUCKET_COUNT];
+        };
+
+        static Shard& GetShard(ObjectGuid guid) { return m_shards[std::hash<ObjectGuid>()(guid) % SHARD_COUNT]; }
+
         // Non instanceable only static
         HashMapHolder() {}
 
+        static Shard m_shards[SHARD_COUNT];
         static LockType i_lock;
-        static MapType  m_objectMap;
 };
 
 class PlayerNameMapHolder
@@ -117,7 +183,13 @@ class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLev
         static Player* FindPlayerByName(char const* name, bool inWorld = true);
         static void KickPlayer(ObjectGuid guid);
 
-        HashMapHolder<Player>::MapType& GetPlayers()
+        HashMapHolder<Player>::SnapshotType GetPlayersSnapshot() const
+        {
+            return HashMapHolder<Player>::GetSnapshot();
+        }
+
+        // copy of the online players keyed by guid, prefer GetPlayersSnapshot() if the guids are not needed
+        HashMapHolder<Player>::MapType GetPlayers() const
         {
             return HashMapHolder<Player>::GetContainer();
         }
@@ -1793,66 +1793,241 @@ int32 ObjectMgr::GetPlayerMapIdByGUID(ObjectGuid const& guid) const
     return -1;
 }
 
-// name must be checked to correctness (if received) before call this function
-ObjectGuid ObjectMgr::GetPlayerGuidByName(std::string name) const
+// character names are unique without regard to case, the index is keyed by the lowered wide name
+static bool MakeCharacterNameKey(std::string const& name, std::wstring& key)
 {
-    ObjectGuid guid;
+    if (!Utf8toWStr(name, key))
+        return false;
 
-    CharacterDatabase.escape_string(name);
+    wstrToLower(key);
+    return true;
+}
 
-    // Player name safe to sending to DB (checked at login) and this function using
-    QueryResult* result = CharacterDatabase.PQuery("SELECT guid FROM characters WHERE name = '%s'", name.c_str());
-    if (result)
+void ObjectMgr::LoadCharacterIdentities()
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    m_characterIdentities.clear();                          // need for reload case
+    m_characterNameIndex.clear();
+
+    //                                                    0          1        2     3     4      5       6         7       8           9             10
+    QueryResult* result = CharacterDatabase.Query("SELECT characters.guid, account, name, race, class, gender, genitive, dative, accusative, instrumental, prepositional "
+                          "FROM characters LEFT JOIN character_declinedname ON characters.guid = character_declinedname.guid");
+
+    if (!result)
     {
-        guid = ObjectGuid(HIGHGUID_PLAYER, (*result)[0].GetUInt32());
+        BarGoLink bar(1);
+        bar.step();
+        sLog.outString(">> Loaded 0 character identities");
+        sLog.outString();
+        return;
+    }
 
-        delete result;
+    m_characterIdentities.reserve(size_t(result->GetRowCount()));
+    m_characterNameIndex.reserve(size_t(result->GetRowCount()));
+
+    BarGoLink bar(result->GetRowCount());
+
+    do
+    {
+        bar.step();
+        Field* fields = result->Fetch();
+
+        uint32 lowguid = fields[0].GetUInt32();
+
+        CharacterIdentity& identity = m_characterIdentities[lowguid];
+        identity.account = fields[1].GetUInt32();
+        identity.name    = fields[2].GetCppString();
+        identity.race    = fields[3].GetUInt8();
+        identity.class_  = fields[4].GetUInt8();
+        identity.gender  = fields[5].GetUInt8();
+
+        // if the first declined name field is empty, the rest must be too
+        if (!fields[6].IsNULL() && !fields[6].GetCppString().empty())
+        {
+            DeclinedName* names = new DeclinedName;
+            for (int i = 0; i < MAX_DECLINED_NAME_CASES; ++i)
+                names->name[i] = fields[6 + i].GetCppString();
+            identity.declinedNames.reset(names);
+        }
+
+        // characters unlinked by delete method 1 keep their entry but have no name
+        std::wstring key;
+        if (!identity.name.empty() && MakeCharacterNameKey(identity.name, key))
+            m_characterNameIndex.emplace(key, lowguid);
     }
+    while (result->NextRow());
+
+    delete result;
+
+    sLog.outString(">> Loaded " SIZEFMTD " character identities", m_characterIdentities.size());
+    sLog.outString();
+}
+
+void ObjectMgr::UnindexCharacterName(uint32 lowguid, std::string const& name)
+{
+    std::wstring key;
+    if (name.empty() || !MakeCharacterNameKey(name, key))
+        return;
+
+    CharacterNameIndex::iterator itr = m_characterNameIndex.find(key);
+    if (itr != m_characterNameIndex.end() && itr->second == lowguid)
+        m_characterNameIndex.erase(itr);
+}
+
+bool ObjectMgr::GetCharacterIdentity(ObjectGuid guid, CharacterIdentity& identity) const
+{
+    if (!guid.IsPlayer())
+        return false;
+
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentityMap::const_iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return false;
+
+    identity = itr->second;
+    return true;
+}
+
+void ObjectMgr::AddCharacterIdentity(ObjectGuid guid, uint32 accountId, std::string const& name, uint8 race, uint8 class_, uint8 gender, DeclinedName const* declinedNames)
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentity& identity = m_characterIdentities[guid.GetCounter()];
+
+    UnindexCharacterName(guid.GetCounter(), identity.name);
+
+    identity.account = accountId;
+    identity.name    = name;
+    identity.race    = race;
+    identity.class_  = class_;
+    identity.gender  = gender;
+    identity.declinedNames.reset(declinedNames ? new DeclinedName(*declinedNames) : nullptr);
+
+    // a restored dump may share the name of an existing character until renamed at login
+    std::wstring key;
+    if (!name.empty() && MakeCharacterNameKey(name, key))
+        m_characterNameIndex.emplace(key, guid.GetCounter());
+}
+
+void ObjectMgr::RenameCharacterIdentity(ObjectGuid guid, std::string const& name)
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentityMap::iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return;
+
+    UnindexCharacterName(guid.GetCounter(), itr->second.name);
+
+    itr->second.name = name;
+    itr->second.declinedNames.reset();                      // declined names are always dropped with the old name
+
+    std::wstring key;
+    if (!name.empty() && MakeCharacterNameKey(name, key))
+        m_characterNameIndex[key] = guid.GetCounter();
+}
+
+void ObjectMgr::UpdateCharacterIdentityGender(ObjectGuid guid, uint8 gender)
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentityMap::iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr != m_characterIdentities.end())
+        itr->second.gender = gender;
+}
+
+void ObjectMgr::SetCharacterIdentityDeclinedNames(ObjectGuid guid, DeclinedName const* declinedNames)
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentityMap::iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr != m_characterIdentities.end())
+        itr->second.declinedNames.reset(declinedNames ? new DeclinedName(*declinedNames) : nullptr);
+}
+
+void ObjectMgr::UnlinkCharacterIdentity(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentityMap::iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return;
+
+    UnindexCharacterName(guid.GetCounter(), itr->second.name);
+
+    // same as the DB row: name and account are cleared, the rest is kept
+    itr->second.name.clear();
+    itr->second.account = 0;
+}
+
+void ObjectMgr::RemoveCharacterIdentity(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterIdentityMap::iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return;
+
+    UnindexCharacterName(guid.GetCounter(), itr->second.name);
+
+    m_characterIdentities.erase(itr);
+}
+
+// name must be checked to correctness (if received) before call this function
+ObjectGuid ObjectMgr::GetPlayerGuidByName(std::string name) const
+{
+    std::wstring key;
+    if (!MakeCharacterNameKey(name, key))
+        return ObjectGuid();
+
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
 
-    return guid;
+    CharacterNameIndex::const_iterator itr = m_characterNameIndex.find(key);
+    if (itr == m_characterNameIndex.end())
+        return ObjectGuid();
+
+    return ObjectGuid(HIGHGUID_PLAYER, itr->second);
 }
 
 bool ObjectMgr::GetPlayerNameByGUID(ObjectGuid guid, std::string& name) const
 {
-    // prevent DB access for online player
+    // online player name is always actual
     if (Player* player = GetPlayer(guid))
     {
         name = player->GetName();
         return true;
     }
 
-    uint32 lowguid = guid.GetCounter();
+    if (!guid.IsPlayer())
+        return false;
 
-    QueryResult* result = CharacterDatabase.PQuery("SELECT name FROM characters WHERE guid = '%u'", lowguid);
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
 
-    if (result)
-    {
-        name = (*result)[0].GetCppString();
-        delete result;
-        return true;
-    }
+    CharacterIdentityMap::const_iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return false;
 
-    return false;
+    name = itr->second.name;
+    return true;
 }
 
 Team ObjectMgr::GetPlayerTeamByGUID(ObjectGuid guid) const
 {
-    // prevent DB access for online player
     if (Player* player = GetPlayer(guid))
         return Player::TeamForRace(player->getRace());
 
-    uint32 lowguid = guid.GetCounter();
+    if (!guid.IsPlayer())
+        return TEAM_NONE;
 
-    QueryResult* result = CharacterDatabase.PQuery("SELECT race FROM characters WHERE guid = '%u'", lowguid);
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
 
-    if (result)
-    {
-        uint8 race = (*result)[0].GetUInt8();
-        delete result;
-        return Player::TeamForRace(race);
-    }
+    CharacterIdentityMap::const_iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return TEAM_NONE;
 
-    return TEAM_NONE;
+    return Player::TeamForRace(itr->second.race);
 }
 
 uint32 ObjectMgr::GetPlayerAccountIdByGUID(ObjectGuid guid) const
@@ -1860,34 +2035,32 @@ uint32 ObjectMgr::GetPlayerAccountIdByGUID(ObjectGuid guid) const
     if (!guid.IsPlayer())
         return 0;
 
-    // prevent DB access for online player
     if (Player* player = GetPlayer(guid))
         return player->GetSession()->GetAccountId();
 
-    uint32 lowguid = guid.GetCounter();
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
 
-    QueryResult* result = CharacterDatabase.PQuery("SELECT account FROM characters WHERE guid = '%u'", lowguid);
-    if (result)
-    {
-        uint32 acc = (*result)[0].GetUInt32();
-        delete result;
-        return acc;
-    }
+    CharacterIdentityMap::const_iterator itr = m_characterIdentities.find(guid.GetCounter());
+    if (itr == m_characterIdentities.end())
+        return 0;
 
-    return 0;
+    return itr->second.account;
 }
 
 uint32 ObjectMgr::GetPlayerAccountIdByPlayerName(const std::string& name) const
 {
-    QueryResult* result = CharacterDatabase.PQuery("SELECT account FROM characters WHERE name = '%s'", name.c_str());
-    if (result)
-    {
-        uint32 acc = (*result)[0].GetUInt32();
-        delete result;
-        return acc;
-    }
+    std::wstring key;
+    if (!MakeCharacterNameKey(name, key))
+        return 0;
 
-    return 0;
+    std::lock_guard<std::mutex> guard(m_characterIdentityLock);
+
+    CharacterNameIndex::const_iterator nameItr = m_characterNameIndex.find(key);
+    if (nameItr == m_characterNameIndex.end())
+        return 0;
+
+    CharacterIdentityMap::const_iterator itr = m_characterIdentities.find(nameItr->second);
+    return itr != m_characterIdentities.end() ? itr->second.account : 0;
 }
 
 void ObjectMgr::LoadItemLocales()
@@ -5343,38 +5516,58 @@ void ObjectMgr::LoadQuestgiverGreetingLocales()
 
 // not very fast function but it is called only once a day, or on starting-up
 /// @param serverUp true if the server is already running, false when the server is started
+// Returned or deleted mails per character DB transaction
+#define OLD_MAILS_BATCH_SIZE 500
+
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
     time_t basetime = time(nullptr);
     DEBUG_LOG("Returning mails current time: hour: %d, minute: %d, second: %d ", localtime(&basetime)->tm_hour, localtime(&basetime)->tm_min, localtime(&basetime)->tm_sec);
+
+    // one row per mail item (or one row for mails without items), mails in expire order
+    //                                  0    1             2         3           4            5              6      7          8                  9              10
+    char const* query = "SELECT m.id, m.messageType, m.sender, m.receiver, m.has_items, m.expire_time, m.cod, m.checked, m.mailTemplateId, mi.item_guid, mi.item_template "
+                        "FROM mail m LEFT JOIN mail_items mi ON mi.mail_id = m.id WHERE m.expire_time < '" UI64FMTD "' ORDER BY m.expire_time, m.id";
+
+    // at runtime the world thread must not wait for a scan of the whole mail table
+    if (serverUp)
+    {
+        CharacterDatabase.AsyncPQuery(this, &ObjectMgr::ReturnOrDeleteOldMailsCallback, uint64(basetime), serverUp, query, uint64(basetime));
+        return;
+    }
+
     // delete all old mails without item and without body immediately, if starting server
-    if (!serverUp)
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE expire_time < '" UI64FMTD "' AND has_items = '0' AND body = ''", (uint64)basetime);
-    //                                                     0  1           2      3        4         5           6   7       8
-    QueryResult* result = CharacterDatabase.PQuery("SELECT id,messageType,sender,receiver,has_items,expire_time,cod,checked,mailTemplateId FROM mail WHERE expire_time < '" UI64FMTD "'", (uint64)basetime);
+    CharacterDatabase.PExecute("DELETE FROM mail WHERE expire_time < '" UI64FMTD "' AND has_items = '0' AND body = ''", (uint64)basetime);
+
+    ReturnOrDeleteOldMailsCallback(CharacterDatabase.PQuery(query, uint64(basetime)), uint64(basetime), serverUp);
+}
+
+void ObjectMgr::ReturnOrDeleteOldMailsCallback(QueryResult* result, uint64 basetime, bool serverUp)
+{
     if (!result)
     {
-        BarGoLink bar(1);
-        bar.step();
-        sLog.outString(">> Only expired mails (need to be return or delete) or DB table `mail` is empty.");
-        sLog.outString();
+        if (!serverUp)
+        {
+            BarGoLink bar(1);
+            bar.step();
+            sLog.outString(">> Only expired mails (need to be return or delete) or DB table `mail` is empty.");
+            sLog.outString();
+        }
         return;                                             // any mails need to be returned or deleted
     }
 
-    // std::ostringstream delitems, delmails; // will be here for optimization
-    // bool deletemail = false, deleteitem = false;
-    // delitems << "DELETE FROM item_instance WHERE guid IN ( ";
-    // delmails << "DELETE FROM mail WHERE id IN ( "
-
-    BarGoLink bar(result->GetRowCount());
+    // no progress bar at runtime
+    std::unique_ptr<BarGoLink> bar(serverUp ? nullptr : new BarGoLink(result->GetRowCount()));
     uint32 count = 0;
-    Field* fields;
+    uint32 batched = 0;
+    bool hasRow = true;
 
-    do
+    CharacterDatabase.BeginTransaction();
+
+    while (hasRow)
     {
-        bar.step();
+        Field* fields = result->Fetch();
 
-        fields = result->Fetch();
         Mail* m = new Mail;
         m->messageID = fields[0].GetUInt32();
         m->messageType = fields[1].GetUInt8();
@@ -5387,6 +5580,21 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         m->checked = fields[7].GetUInt32();
         m->mailTemplateId = fields[8].GetInt16();
 
+        // collect the item rows of this mail
+        do
+        {
+            fields = result->Fetch();
+            if (fields[0].GetUInt32() != m->messageID)
+                break;
+
+            if (bar)
+                bar->step();
+
+            if (has_items && !fields[9].IsNULL())
+                m->AddItem(fields[9].GetUInt32(), fields[10].GetUInt32());
+        }
+        while ((hasRow = result->NextRow()));
+
         Player* pl = nullptr;
         if (serverUp)
             pl = GetPlayer(m->receiverGuid);
@@ -5397,59 +5605,62 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             delete m;
             continue;
         }
-        // delete or return mail:
-        if (has_items)
-        {
-            QueryResult* resultItems = CharacterDatabase.PQuery("SELECT item_guid,item_template FROM mail_items WHERE mail_id='%u'", m->messageID);
-            if (resultItems)
-            {
-                do
-                {
-                    Field* fields2 = resultItems->Fetch();
 
-                    uint32 item_guid_low = fields2[0].GetUInt32();
-                    uint32 item_template = fields2[1].GetUInt32();
+        if (++batched >= OLD_MAILS_BATCH_SIZE)
+        {
+            CharacterDatabase.CommitTransaction();
+            CharacterDatabase.BeginTransaction();
+            batched = 0;
+        }
 
-                    m->AddItem(item_guid_low, item_template);
-                }
-                while (resultItems->NextRow());
+        // the rows may be outdated at runtime: the receiver can have taken items, returned or deleted the mail since the
+        // query, so every statement only touches mails that are still expired and items still attached to the mail
+        uint32 const receiver = m->receiverGuid.GetCounter();
 
-                delete resultItems;
-            }
+        // delete or return mail:
+        if (has_items)
+        {
             // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
             if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
             {
                 // mail open and then not returned
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                    CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", itr2->item_guid);
+                    CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u' AND guid IN (SELECT item_guid FROM mail_items WHERE mail_id = '%u' AND receiver = '%u')",
+                                               itr2->item_guid, m->messageID, receiver);
             }
             else
             {
-                // mail will be returned:
-                CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u'",
-                                           m->receiverGuid.GetCounter(), m->sender, (uint64)(basetime + 30 * DAY), (uint64)basetime, MAIL_CHECK_MASK_RETURNED, m->messageID);
                 for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
                 {
                     // update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    CharacterDatabase.PExecute("UPDATE mail_items SET receiver = %u WHERE item_guid = '%u'", m->sender, itr2->item_guid);
-                    CharacterDatabase.PExecute("UPDATE item_instance SET owner_guid = %u WHERE guid = '%u'", m->sender, itr2->item_guid);
+                    CharacterDatabase.PExecute("UPDATE item_instance SET owner_guid = %u WHERE guid = '%u' AND guid IN (SELECT item_guid FROM mail_items WHERE mail_id = '%u' AND receiver = '%u')",
+                                               m->sender, itr2->item_guid, m->messageID, receiver);
+                    CharacterDatabase.PExecute("UPDATE mail_items SET receiver = %u WHERE item_guid = '%u' AND mail_id = '%u' AND receiver = '%u'",
+                                               m->sender, itr2->item_guid, m->messageID, receiver);
                 }
+                // mail will be returned:
+                CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u' AND receiver = '%u' AND expire_time < '" UI64FMTD "'",
+                                           receiver, m->sender, basetime + 30 * DAY, basetime, MAIL_CHECK_MASK_RETURNED, m->messageID, receiver, basetime);
                 delete m;
                 continue;
             }
         }
 
-        // deletemail = true;
-        // delmails << m->messageID << ", ";
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", m->messageID);
+        CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u' AND receiver = '%u' AND expire_time < '" UI64FMTD "'", m->messageID, receiver, basetime);
         delete m;
         ++count;
     }
-    while (result->NextRow());
+
+    CharacterDatabase.CommitTransaction();
     delete result;
 
-    sLog.outString(">> Loaded %u mails", count);
-    sLog.outString();
+    if (serverUp)
+        DETAIL_LOG("Returned or deleted %u expired mails", count);
+    else
+    {
+        sLog.outString(">> Loaded %u mails", count);
+        sLog.outString();
+    }
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
@@ -37,6 +37,8 @@
 
 #include <map>
 #include <climits>
+#include <memory>
+#include <mutex>
 
 class Group;
 class ArenaTeam;
@@ -350,6 +352,19 @@ struct GraveYardData
 typedef std::multimap < uint32 /*zoneId*/, GraveYardData > GraveYardMap;
 typedef std::pair<GraveYardMap::const_iterator, GraveYardMap::const_iterator> GraveYardMapBounds;
 
+// identity data of every character in DB, kept current for offline name/team/account lookups
+struct CharacterIdentity
+{
+    CharacterIdentity() : account(0), race(0), class_(0), gender(0) {}
+
+    uint32 account;                                         // 0 for characters unlinked at delete
+    std::string name;                                       // empty for characters unlinked at delete
+    uint8 race;
+    uint8 class_;
+    uint8 gender;
+    std::shared_ptr<DeclinedName const> declinedNames;      // nullptr if not set
+};
+
 struct QuestgiverGreeting
 {
     std::string text;
@@ -598,6 +613,16 @@ class ObjectMgr
         uint32 GetPlayerAccountIdByGUID(ObjectGuid guid) const;
         uint32 GetPlayerAccountIdByPlayerName(const std::string& name) const;
 
+        // character identity cache, replaces the characters table lookups above
+        void LoadCharacterIdentities();
+        bool GetCharacterIdentity(ObjectGuid guid, CharacterIdentity& identity) const;
+        void AddCharacterIdentity(ObjectGuid guid, uint32 accountId, std::string const& name, uint8 race, uint8 class_, uint8 gender, DeclinedName const* declinedNames = nullptr);
+        void RenameCharacterIdentity(ObjectGuid guid, std::string const& name);
+        void UpdateCharacterIdentityGender(ObjectGuid guid, uint8 gender);
+        void SetCharacterIdentityDeclinedNames(ObjectGuid guid, DeclinedName const* declinedNames);
+        void UnlinkCharacterIdentity(ObjectGuid guid);
+        void RemoveCharacterIdentity(ObjectGuid guid);
+
         uint32 GetNearestTaxiNode(float x, float y, float z, uint32 mapid, Team team);
         void GetTaxiPath(uint32 source, uint32 destination, uint32& path, uint32& cost);
         uint32 GetTaxiMountDisplayId(uint32 id, Team team, bool allowed_alt_team = false);
@@ -819,6 +844,7 @@ class ObjectMgr
         }
 
         void ReturnOrDeleteOldMails(bool serverUp);
+        void ReturnOrDeleteOldMailsCallback(QueryResult* result, uint64 basetime, bool serverUp);
 
         void SetHighestGuids();
 
@@ -1260,6 +1286,15 @@ class ObjectMgr
         typedef std::set<std::wstring> ReservedNamesMap;
         ReservedNamesMap    m_ReservedNames;
 
+        // character identities and case-insensitive name index, accessed from map threads too
+        typedef std::unordered_map<uint32 /*lowguid*/, CharacterIdentity> CharacterIdentityMap;
+        typedef std::unordered_map<std::wstring, uint32 /*lowguid*/> CharacterNameIndex;
+        CharacterIdentityMap m_characterIdentities;
+        CharacterNameIndex  m_characterNameIndex;
+        mutable std::mutex  m_characterIdentityLock;
+
+        void UnindexCharacterName(uint32 lowguid, std::string const& name);   // caller holds m_characterIdentityLock
+
         GraveYardMap        mGraveYardMap;
 
         GameTeleMap         m_GameTeleMap;
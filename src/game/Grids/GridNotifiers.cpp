@@ -75,9 +75,12 @@ void VisibleNotifier::Notify()
     if (i_data.HasData())
     {
         // send create/outofrange packet to player (except player create updates that already sent using SendUpdateToPlayer)
-        WorldPacket packet;
-        i_data.BuildPacket(packet);
-        player.GetSession()->SendPacket(packet);
+        if (!player.GetSession()->IsBotSession())
+        {
+            WorldPacket packet;
+            i_data.BuildPacket(packet);
+            player.GetSession()->SendPacket(packet);
+        }
 
         // send out of range to other players if need
         GuidSet const& oor = i_data.GetOutOfRangeGUIDs();
@@ -102,6 +105,14 @@ void VisibleNotifier::Notify()
     }
 }
 
+void BroadcastPacket::SendTo(WorldSession* session)
+{
+    if (!i_shared)
+        i_shared = std::make_shared<WorldPacket const>(i_message);
+
+    session->SendPacket(i_shared);
+}
+
 void MessageDeliverer::Visit(CameraMapType& m)
 {
     for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -114,7 +125,7 @@ void MessageDeliverer::Visit(CameraMapType& m)
                 continue;
 
             if (WorldSession* session = owner->GetSession())
-                session->SendPacket(i_message);
+                i_message.SendTo(session);
         }
     }
 }
@@ -129,7 +140,7 @@ void MessageDelivererExcept::Visit(CameraMapType& m)
             continue;
 
         if (WorldSession* session = owner->GetSession())
-            session->SendPacket(i_message);
+            i_message.SendTo(session);
     }
 }
 
@@ -141,7 +152,7 @@ void ObjectMessageDeliverer::Visit(CameraMapType& m)
             continue;
 
         if (WorldSession* session = iter->getSource()->GetOwner()->GetSession())
-            session->SendPacket(i_message);
+            i_message.SendTo(session);
     }
 }
 
@@ -159,7 +170,7 @@ void MessageDistDeliverer::Visit(CameraMapType& m)
                 continue;
 
             if (WorldSession* session = owner->GetSession())
-                session->SendPacket(i_message);
+                i_message.SendTo(session);
         }
     }
 }
@@ -174,7 +185,7 @@ void ObjectMessageDistDeliverer::Visit(CameraMapType& m)
                 continue;
 
             if (WorldSession* session = iter->getSource()->GetOwner()->GetSession())
-                session->SendPacket(i_message);
+                i_message.SendTo(session);
         }
     }
 }
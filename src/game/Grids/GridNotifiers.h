@@ -58,10 +58,21 @@ namespace MaNGOS
         GuidSet m_unvisitedGuids;
     };
 
+    // Broadcast deliverers copy the packet once on the first receiver, all sockets queue the same copy
+    struct BroadcastPacket
+    {
+        explicit BroadcastPacket(WorldPacket const& msg) : i_message(msg) {}
+
+        void SendTo(WorldSession* session);
+
+        WorldPacket const& i_message;
+        WorldPacketShared i_shared;
+    };
+
     struct MessageDeliverer
     {
         Player const& i_player;
-        WorldPacket const& i_message;
+        BroadcastPacket i_message;
         bool i_toSelf;
         MessageDeliverer(Player const& pl, WorldPacket const& msg, bool to_self) : i_player(pl), i_message(msg), i_toSelf(to_self) {}
         void Visit(CameraMapType& m);
@@ -71,7 +82,7 @@ namespace MaNGOS
     struct MessageDelivererExcept
     {
         uint32        i_phaseMask;
-        WorldPacket const&  i_message;
+        BroadcastPacket i_message;
         Player const* i_skipped_receiver;
 
         MessageDelivererExcept(WorldObject const* obj, WorldPacket const& msg, Player const* skipped)
@@ -84,7 +95,7 @@ namespace MaNGOS
     struct ObjectMessageDeliverer
     {
         uint32 i_phaseMask;
-        WorldPacket const& i_message;
+        BroadcastPacket i_message;
         explicit ObjectMessageDeliverer(WorldObject const& obj, WorldPacket const& msg)
             : i_phaseMask(obj.GetPhaseMask()), i_message(msg) {}
         void Visit(CameraMapType& m);
@@ -94,7 +105,7 @@ namespace MaNGOS
     struct MessageDistDeliverer
     {
         Player const& i_player;
-        WorldPacket const& i_message;
+        BroadcastPacket i_message;
         bool i_toSelf;
         bool i_ownTeamOnly;
         float i_dist;
@@ -108,7 +119,7 @@ namespace MaNGOS
     struct ObjectMessageDistDeliverer
     {
         WorldObject const& i_object;
-        WorldPacket const& i_message;
+        BroadcastPacket i_message;
         float i_dist;
         ObjectMessageDistDeliverer(WorldObject const& obj, WorldPacket const& msg, float dist) : i_object(obj), i_message(msg), i_dist(dist) {}
         void Visit(CameraMapType& m);
@@ -21,32 +21,29 @@
 #include "Log/Log.h"
 
 void
-InvalidState::Update(Map&, NGridType&, GridInfo&, const uint32& /*x*/, const uint32& /*y*/, const uint32&) const
+InvalidState::Update(Map&, NGridType&, GridInfo&, const uint32& /*x*/, const uint32& /*y*/) const
 {
 }
 
 void
-ActiveState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, const uint32& y, const uint32& t_diff) const
+ActiveState::Update(Map& m, NGridType& grid, GridInfo&, const uint32& x, const uint32& y) const
 {
-    // Only check grid activity every (grid_expiry/10) ms, because it's really useless to do it every cycle
-    info.UpdateTimeTracker(t_diff);
-    if (info.getTimeTracker().Passed())
+    // Grid activity is only rechecked every (grid_expiry/10) ms, because it's really useless to do it every cycle
+    if (grid.ActiveObjectsInGrid() == 0 && !m.ActiveObjectsNearGrid(x, y))
     {
-        if (grid.ActiveObjectsInGrid() == 0 && !m.ActiveObjectsNearGrid(x, y))
-        {
-            ObjectGridStoper stoper(grid);
-            stoper.StopN();
-            grid.SetGridState(GRID_STATE_IDLE);
-        }
-        else
-        {
-            m.ResetGridExpiry(grid, 0.1f);
-        }
+        ObjectGridStoper stoper(grid);
+        stoper.StopN();
+        grid.SetGridState(GRID_STATE_IDLE);
+        m.ResetGridExpiry(grid, 0.0f);
+    }
+    else
+    {
+        m.ResetGridExpiry(grid, 0.1f);
     }
 }
 
 void
-IdleState::Update(Map& m, NGridType& grid, GridInfo&, const uint32& x, const uint32& y, const uint32&) const
+IdleState::Update(Map& m, NGridType& grid, GridInfo&, const uint32& x, const uint32& y) const
 {
     m.ResetGridExpiry(grid);
     grid.SetGridState(GRID_STATE_REMOVAL);
@@ -54,18 +51,17 @@ IdleState::Update(Map& m, NGridType& grid, GridInfo&, const uint32& x, const uin
 }
 
 void
-RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, const uint32& y, const uint32& t_diff) const
+RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, const uint32& y) const
 {
-    if (!info.getUnloadLock())
+    if (info.getUnloadLock())
+    {
+        m.ResetGridExpiry(grid);
+        return;
+    }
+
+    if (!m.StartGridUnload(x, y))
     {
-        info.UpdateTimeTracker(t_diff);
-        if (info.getTimeTracker().Passed())
-        {
-            if (!m.UnloadGrid(x, y, false))
-            {
-                DEBUG_LOG("Grid[%u,%u] for map %u differed unloading due to players or active objects nearby", x, y, m.GetId());
-                m.ResetGridExpiry(grid);
-            }
-        }
+        DEBUG_LOG("Grid[%u,%u] for map %u differed unloading due to players or active objects nearby", x, y, m.GetId());
+        m.ResetGridExpiry(grid);
     }
 }
@@ -21,11 +21,12 @@
 
 #include "Maps/Map.h"
 
+// Update is called by the map when the expiry scheduled for the grid with Map::ResetGridExpiry has passed
 class GridState
 {
     public:
 
-        virtual void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const = 0;
+        virtual void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y) const = 0;
         virtual ~GridState() {}
 };
 
@@ -33,7 +34,7 @@ class InvalidState : public GridState
 {
     public:
 
-        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
+        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y) const override;
         virtual ~InvalidState() {}
 };
 
@@ -41,7 +42,7 @@ class ActiveState : public GridState
 {
     public:
 
-        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
+        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y) const override;
         virtual ~ActiveState() {}
 };
 
@@ -49,7 +50,7 @@ class IdleState : public GridState
 {
     public:
 
-        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
+        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y) const override;
         virtual ~IdleState() {}
 };
 
@@ -57,7 +58,7 @@ class RemovalState : public GridState
 {
     public:
 
-        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
+        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y) const override;
         virtual ~RemovalState() {}
 };
 
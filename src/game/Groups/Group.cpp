@@ -33,6 +33,7 @@
 #include "LuaEngine/LuaEngine.h"
 #endif
 #ifdef BUILD_DEPRECATED_PLAYERBOT
+	#include "PlayerBot/Base/PlayerbotAI.h"
 	#include "PlayerBot/Base/PlayerbotMgr.h"
 	#include "Config/Config.h"
 	extern Config botConfig;
@@ -414,6 +415,9 @@ uint32 Group::RemoveMember(ObjectGuid guid, uint8 method)
             WorldPacket data(SMSG_GROUP_SET_LEADER, (m_leaderName.size() + 1));
             data << m_leaderName;
             BroadcastPacket(data, true);
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+            BroadcastBotEvent(PlayerbotEvent(BOT_EVENT_GROUP_SET_LEADER, m_leaderGuid), true);
+#endif
         }
 
         SendUpdate();
@@ -448,6 +452,9 @@ void Group::ChangeLeader(ObjectGuid guid)
     WorldPacket data(SMSG_GROUP_SET_LEADER, slot->name.size() + 1);
     data << slot->name;
     BroadcastPacket(data, true);
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    BroadcastBotEvent(PlayerbotEvent(BOT_EVENT_GROUP_SET_LEADER, slot->guid), true);
+#endif
     SendUpdate();
 }
 
@@ -727,6 +734,22 @@ void Group::BroadcastPacket(WorldPacket const& packet, bool ignorePlayersInBGRai
     }
 }
 
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+void Group::BroadcastBotEvent(PlayerbotEvent const& event, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
+{
+    for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
+    {
+        Player* pl = itr->getSource();
+        if (!pl || (ignore && pl->GetObjectGuid() == ignore) || (ignorePlayersInBGRaid && pl->GetGroup() != this))
+            continue;
+
+        if (PlayerbotAI* ai = pl->GetPlayerbotAI())
+            if (group == -1 || itr->getSubGroup() == group)
+                ai->HandleBotEvent(event);
+    }
+}
+#endif
+
 void Group::BroadcastReadyCheck(WorldPacket const& packet)
 {
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
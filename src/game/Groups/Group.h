@@ -36,6 +36,9 @@ class BattleGround;
 class DungeonPersistentState;
 class Field;
 class Unit;
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+struct PlayerbotEvent;
+#endif
 
 #define MAX_GROUP_SIZE 5
 #define MAX_RAID_SIZE 40
@@ -285,6 +288,10 @@ class Group
         void UpdateOfflineLeader(time_t time, uint32 delay);
         // ignore: GUID of player that will be ignored
         void BroadcastPacket(WorldPacket const& packet, bool ignorePlayersInBGRaid, int group = -1, ObjectGuid ignore = ObjectGuid());
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+        // same member selection as BroadcastPacket, delivered to the bot members only
+        void BroadcastBotEvent(PlayerbotEvent const& event, bool ignorePlayersInBGRaid, int group = -1, ObjectGuid ignore = ObjectGuid());
+#endif
         void BroadcastReadyCheck(WorldPacket const& packet);
         void OfflineReadyCheck();
 
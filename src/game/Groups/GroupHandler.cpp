@@ -36,6 +36,9 @@
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
 #endif
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+#include "PlayerBot/Base/PlayerbotAI.h"
+#endif
 
 /* differeces from off:
     -you can uninvite yourself - is is useful
@@ -50,6 +53,17 @@
 
 void WorldSession::SendPartyResult(PartyOperation operation, const std::string& member, PartyResult res)
 {
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    if (PlayerbotAI* ai = _player ? _player->GetPlayerbotAI() : nullptr)
+    {
+        PlayerbotEvent event(BOT_EVENT_PARTY_RESULT, ObjectGuid(), operation);
+        event.value2 = res;
+        event.text = member;
+        ai->HandleBotEvent(event);
+        return;
+    }
+#endif
+
     WorldPacket data(SMSG_PARTY_COMMAND_RESULT, 4 + member.size() + 1 + 4 + 4 + 8);
     data << uint32(operation);
     data << member;                                         // max len 48
@@ -62,6 +76,15 @@ void WorldSession::SendPartyResult(PartyOperation operation, const std::string&
 
 void WorldSession::SendGroupInvite(Player* player, bool alreadyInGroup /*= false*/)
 {
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    if (PlayerbotAI* ai = _player ? _player->GetPlayerbotAI() : nullptr)
+    {
+        if (!alreadyInGroup)
+            ai->HandleBotEvent(PlayerbotEvent(BOT_EVENT_GROUP_INVITE));
+        return;
+    }
+#endif
+
     WorldPacket data(SMSG_GROUP_INVITE, 21);                // guess size
     data.WriteBit(0);
     data.WriteGuidMask<0, 3, 2>(player->GetObjectGuid());
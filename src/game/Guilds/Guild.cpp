@@ -51,6 +51,7 @@ void MemberSlot::UpdateLogoutTime()
 void MemberSlot::SetPNOTE(std::string pnote)
 {
     Pnote = pnote;
+    guild->InvalidateRoster();
 
     // pnote now can be used for encoding to DB
     CharacterDatabase.escape_string(pnote);
@@ -60,6 +61,7 @@ void MemberSlot::SetPNOTE(std::string pnote)
 void MemberSlot::SetOFFNOTE(std::string offnote)
 {
     OFFnote = offnote;
+    guild->InvalidateRoster();
 
     // offnote now can be used for encoding to DB
     CharacterDatabase.escape_string(offnote);
@@ -68,7 +70,9 @@ void MemberSlot::SetOFFNOTE(std::string offnote)
 
 void MemberSlot::ChangeRank(uint32 newRank)
 {
+    uint32 oldRank = RankId;
     RankId = newRank;
+    guild->MemberRankChanged(*this, oldRank);
 
     Player* player = sObjectMgr.GetPlayer(guid);
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
@@ -94,6 +98,7 @@ Guild::Guild()
     m_accountsNumber = 0;
 
     m_CreatedDate = 0;
+    m_rosterCacheTime = 0;
 
     m_GuildBankMoney = 0;
 
@@ -191,6 +196,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
     // fill player data
     MemberSlot newmember;
 
+    newmember.guild = this;
     newmember.guid = plGuid;
 
     if (pl)
@@ -248,9 +254,12 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
         pl->SetGuildLevel(GetLevel());
         pl->SetRank(newmember.RankId);
         pl->SetGuildInvited(0);
+
+        AddOnlineMember(pl, newmember.RankId);
     }
 
     UpdateAccountsNumber();
+    InvalidateRoster();
 
 #ifdef BUILD_ELUNA
     // used by eluna
@@ -264,6 +273,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
 void Guild::SetMOTD(std::string motd)
 {
     MOTD = motd;
+    InvalidateRoster();
 
     // motd now can be used for encoding to DB
     CharacterDatabase.escape_string(motd);
@@ -279,6 +289,7 @@ void Guild::SetMOTD(std::string motd)
 void Guild::SetGINFO(std::string ginfo)
 {
     GINFO = ginfo;
+    InvalidateRoster();
 
     // ginfo now can be used for encoding to DB
     CharacterDatabase.escape_string(ginfo);
@@ -452,6 +463,7 @@ bool Guild::LoadMembersFromDB(QueryResult* guildMembersResult)
             break;
 
         MemberSlot newmember;
+        newmember.guild = this;
         uint32 lowguid = fields[1].GetUInt32();
         newmember.guid = ObjectGuid(HIGHGUID_PLAYER, lowguid);
         newmember.RankId = fields[2].GetUInt32();
@@ -573,6 +585,8 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
     }
 
     members.erase(lowguid);
+    RemoveOnlineMember(lowguid);
+    InvalidateRoster();
 
     Player* player = sObjectMgr.GetPlayer(guid);
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
@@ -620,12 +634,18 @@ void Guild::BroadcastToGuild(WorldSession* session, const std::string& msg, uint
     WorldPacket data;
     ChatHandler::BuildChatPacket(data, CHAT_MSG_GUILD, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (uint32 rankId = 0; rankId < m_Ranks.size() && rankId < GUILD_RANKS_MAX_COUNT; ++rankId)
     {
-        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        if (!HasRankRight(rankId, GR_RIGHT_GCHATLISTEN))
+            continue;
 
-        if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
-            pl->GetSession()->SendPacket(data);
+        for (OnlineMemberMap::const_iterator itr = m_onlineMembersByRank[rankId].begin(); itr != m_onlineMembersByRank[rankId].end(); ++itr)
+        {
+            Player* pl = itr->second;
+
+            if (pl->GetSession() && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
+                pl->GetSession()->SendPacket(data);
+        }
     }
 }
 
@@ -636,12 +656,18 @@ void Guild::BroadcastAddonToGuild(WorldSession* session, const std::string& msg,
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, CHAT_MSG_GUILD, msg.c_str(), LANG_ADDON, CHAT_TAG_NONE, ObjectGuid(), NULL, ObjectGuid(), NULL, NULL, 0, prefix.c_str());
 
-        for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+        for (uint32 rankId = 0; rankId < m_Ranks.size() && rankId < GUILD_RANKS_MAX_COUNT; ++rankId)
         {
-            Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+            if (!HasRankRight(rankId, GR_RIGHT_GCHATLISTEN))
+                continue;
 
-            if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_GCHATLISTEN) && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetObjectGuid()))
-                pl->GetSession()->SendPacket(data);
+            for (OnlineMemberMap::const_iterator itr = m_onlineMembersByRank[rankId].begin(); itr != m_onlineMembersByRank[rankId].end(); ++itr)
+            {
+                Player* pl = itr->second;
+
+                if (pl->GetSession() && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetObjectGuid()))
+                    pl->GetSession()->SendPacket(data);
+            }
         }
     }
 }
@@ -655,15 +681,21 @@ void Guild::BroadcastToOfficers(WorldSession* session, const std::string& msg, u
     if (!player || !HasRankRight(player->GetRank(), GR_RIGHT_OFFCHATSPEAK))
         return;
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    WorldPacket data;
+    ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
+
+    for (uint32 rankId = 0; rankId < m_Ranks.size() && rankId < GUILD_RANKS_MAX_COUNT; ++rankId)
     {
-        WorldPacket data;
-        ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), Language(language), player->GetChatTag(), player->GetObjectGuid(), player->GetName());
+        if (!HasRankRight(rankId, GR_RIGHT_OFFCHATLISTEN))
+            continue;
 
-        Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        for (OnlineMemberMap::const_iterator itr = m_onlineMembersByRank[rankId].begin(); itr != m_onlineMembersByRank[rankId].end(); ++itr)
+        {
+            Player* pl = itr->second;
 
-        if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
-            pl->GetSession()->SendPacket(data);
+            if (pl->GetSession() && !pl->GetSocial()->HasIgnore(player->GetObjectGuid()))
+                pl->GetSession()->SendPacket(data);
+        }
     }
 }
 
@@ -671,42 +703,98 @@ void Guild::BroadcastAddonToOfficers(WorldSession* session, const std::string& m
 {
     if (session && session->GetPlayer() && HasRankRight(session->GetPlayer()->GetRank(), GR_RIGHT_OFFCHATSPEAK))
     {
-        for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+        WorldPacket data;
+        ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), LANG_ADDON, CHAT_TAG_NONE, ObjectGuid(), NULL, ObjectGuid(), NULL, NULL, 0, prefix.c_str());
+
+        for (uint32 rankId = 0; rankId < m_Ranks.size() && rankId < GUILD_RANKS_MAX_COUNT; ++rankId)
         {
-            WorldPacket data;
-            ChatHandler::BuildChatPacket(data, CHAT_MSG_OFFICER, msg.c_str(), LANG_ADDON, CHAT_TAG_NONE, ObjectGuid(), NULL, ObjectGuid(), NULL, NULL, 0, prefix.c_str());
+            if (!HasRankRight(rankId, GR_RIGHT_OFFCHATLISTEN))
+                continue;
 
-            Player* pl = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+            for (OnlineMemberMap::const_iterator itr = m_onlineMembersByRank[rankId].begin(); itr != m_onlineMembersByRank[rankId].end(); ++itr)
+            {
+                Player* pl = itr->second;
 
-            if (pl && pl->GetSession() && HasRankRight(pl->GetRank(), GR_RIGHT_OFFCHATLISTEN) && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetObjectGuid()))
-                pl->GetSession()->SendPacket(data);
+                if (pl->GetSession() && !pl->GetSocial()->HasIgnore(session->GetPlayer()->GetObjectGuid()))
+                    pl->GetSession()->SendPacket(data);
+            }
         }
     }
 }
 
 void Guild::BroadcastPacket(WorldPacket const& packet)
 {
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
-    {
-        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (player)
-            player->GetSession()->SendPacket(packet);
-    }
+    for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+        itr->second->GetSession()->SendPacket(packet);
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const& packet, uint32 rankId)
 {
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    if (rankId >= GUILD_RANKS_MAX_COUNT)
+        return;
+
+    for (OnlineMemberMap::const_iterator itr = m_onlineMembersByRank[rankId].begin(); itr != m_onlineMembersByRank[rankId].end(); ++itr)
+        itr->second->GetSession()->SendPacket(packet);
+}
+
+void Guild::AddOnlineMember(Player* player, uint32 rankId)
+{
+    uint32 lowguid = player->GetGUIDLow();
+
+    m_onlineMembers[lowguid] = player;
+    if (rankId < GUILD_RANKS_MAX_COUNT)
+        m_onlineMembersByRank[rankId][lowguid] = player;
+}
+
+void Guild::RemoveOnlineMember(uint32 lowguid)
+{
+    if (!m_onlineMembers.erase(lowguid))
+        return;
+
+    for (uint32 rankId = 0; rankId < GUILD_RANKS_MAX_COUNT; ++rankId)
+        m_onlineMembersByRank[rankId].erase(lowguid);
+}
+
+void Guild::MemberLoggedIn(Player* player)
+{
+    MemberSlot* slot = GetMemberSlot(player->GetObjectGuid());
+    if (!slot)
+        return;
+
+    AddOnlineMember(player, slot->RankId);
+    InvalidateRoster();
+}
+
+void Guild::MemberLoggedOut(Player* player)
+{
+    RemoveOnlineMember(player->GetGUIDLow());
+    InvalidateRoster();
+}
+
+void Guild::MemberStatsChanged(Player* player)
+{
+    if (MemberSlot* slot = GetMemberSlot(player->GetObjectGuid()))
     {
-        if (itr->second.RankId == rankId)
-        {
-            Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-            if (player)
-                player->GetSession()->SendPacket(packet);
-        }
+        slot->SetMemberStats(player);
+        InvalidateRoster();
     }
 }
 
+void Guild::MemberRankChanged(MemberSlot const& slot, uint32 oldRank)
+{
+    InvalidateRoster();
+
+    uint32 lowguid = slot.guid.GetCounter();
+    OnlineMemberMap::const_iterator itr = m_onlineMembers.find(lowguid);
+    if (itr == m_onlineMembers.end())
+        return;
+
+    if (oldRank < GUILD_RANKS_MAX_COUNT)
+        m_onlineMembersByRank[oldRank].erase(lowguid);
+    if (slot.RankId < GUILD_RANKS_MAX_COUNT)
+        m_onlineMembersByRank[slot.RankId][lowguid] = itr->second;
+}
+
 // add new event to all already connected guild memebers
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
 {
@@ -777,6 +865,7 @@ void Guild::DelRank(uint32 rankId)
         return;
 
     RankList::iterator itr = m_Ranks.erase(m_Ranks.begin() + rankId);
+    InvalidateRoster();
     // delete lowest guild_rank
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM guild_rank WHERE rid ='%u' AND guildid='%u'", rankId, m_Id);
@@ -898,19 +987,42 @@ void Guild::Disband()
     sGuildMgr.RemoveGuild(m_Id);
 }
 
+/**
+ * Send guild roster
+ *
+ * Single requests reuse the last built packet for up to GUILD_ROSTER_CACHE_TIME seconds
+ * unless guild data changed, broadcasts always rebuild it.
+ */
 void Guild::Roster(WorldSession* session /*= nullptr*/)
+{
+    time_t now = time(nullptr);
+    if (!session || !m_rosterCacheTime || now >= m_rosterCacheTime + GUILD_ROSTER_CACHE_TIME)
+    {
+        BuildRoster(m_rosterCache);
+        m_rosterCacheTime = now;
+    }
+
+    if (session)
+        session->SendPacket(m_rosterCache);
+    else
+        BroadcastPacket(m_rosterCache);
+    DEBUG_LOG("WORLD: Sent (SMSG_GUILD_ROSTER)");
+}
+
+void Guild::BuildRoster(WorldPacket& data)
 {
     ByteBuffer buffer;
 
     // we can only guess size
-    WorldPacket data(SMSG_GUILD_ROSTER, (4 + MOTD.length() + 1 + GINFO.length() + 1 + 4 + members.size() * 50));
+    data.Initialize(SMSG_GUILD_ROSTER, (4 + MOTD.length() + 1 + GINFO.length() + 1 + 4 + members.size() * 50));
     data.WriteBits(MOTD.length(), 11);
     data.WriteBits(members.size(), 18);
 
     for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
     {
-        MemberSlot const member = itr->second;
-        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
+        MemberSlot const& member = itr->second;
+        OnlineMemberMap::const_iterator onlineItr = m_onlineMembers.find(itr->first);
+        Player* player = onlineItr != m_onlineMembers.end() ? onlineItr->second : nullptr;
 
         ObjectGuid guid = member.guid;
         data.WriteGuidMask<3, 4>(guid);
@@ -978,12 +1090,6 @@ void Guild::Roster(WorldSession* session /*= nullptr*/)
     data << uint32(0);                                      // weekly rep cap
     data << secsToTimeBitFields(m_CreatedDate);
     data << uint32(0);
-
-    if (session)
-        session->SendPacket(data);
-    else
-        BroadcastPacket(data);
-    DEBUG_LOG("WORLD: Sent (SMSG_GUILD_ROSTER)");
 }
 
 void Guild::Query(WorldSession* session)
@@ -1262,11 +1368,9 @@ void Guild::DisplayGuildBankContentUpdate(uint8 TabId, int32 slot1, int32 slot2)
     size_t rempos = data.wpos();
     data << uint32(0);                                      // item withdraw amount, will be filled later
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (!player)
-            continue;
+        Player* player = itr->second;
 
         if (!IsMemberHaveRights(itr->first, TabId, GUILD_BANK_RIGHT_VIEW_TAB))
             continue;
@@ -1301,11 +1405,9 @@ void Guild::DisplayGuildBankContentUpdate(uint8 TabId, GuildItemPosCountVec cons
     size_t rempos = data.wpos();
     data << uint32(0);                                      // item withdraw amount, will be filled later
 
-    for (MemberList::const_iterator itr = members.begin(); itr != members.end(); ++itr)
+    for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
     {
-        Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first));
-        if (!player)
-            continue;
+        Player* player = itr->second;
 
         if (!IsMemberHaveRights(itr->first, TabId, GUILD_BANK_RIGHT_VIEW_TAB))
             continue;
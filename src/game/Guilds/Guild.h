@@ -32,6 +32,8 @@ class Item;
 
 #define GUILD_RANK_NONE         0xFF
 
+#define GUILD_ROSTER_CACHE_TIME 10                          // seconds a built SMSG_GUILD_ROSTER is reused for single requests
+
 enum GuildDefaultRanks
 {
     // these ranks can be modified, but they cannot be deleted
@@ -284,6 +286,8 @@ struct GuildItemPosCount
 };
 typedef std::vector<GuildItemPosCount> GuildItemPosCountVec;
 
+class Guild;
+
 struct MemberSlot
 {
     void SetMemberStats(Player* player);
@@ -292,6 +296,7 @@ struct MemberSlot
     void SetOFFNOTE(std::string offnote);
     void ChangeRank(uint32 newRank);
 
+    Guild* guild;                                           // owner, informed about rank and note changes
     ObjectGuid guid;
     uint32 accountId;
     std::string Name;
@@ -360,6 +365,11 @@ class Guild
         bool AddMember(ObjectGuid plGuid, uint32 plRank);
         bool DelMember(ObjectGuid guid, bool isDisbanding = false);
         bool ChangeMemberRank(ObjectGuid guid, uint8 newRank);
+        void MemberLoggedIn(Player* player);
+        void MemberLoggedOut(Player* player);
+        void MemberStatsChanged(Player* player);            // level or zone of an online member changed
+        void MemberRankChanged(MemberSlot const& slot, uint32 oldRank);
+        void InvalidateRoster() { m_rosterCacheTime = 0; }
         // lowest rank is the count of ranks - 1 (the highest rank_id in table)
         uint32 GetLowestRank() const { return m_Ranks.size() - 1; }
 
@@ -393,10 +403,9 @@ class Guild
         template<class Do>
         void BroadcastWorker(Do& _do, Player* except = nullptr)
         {
-            for (MemberList::iterator itr = members.begin(); itr != members.end(); ++itr)
-                if (Player* player = ObjectAccessor::FindPlayer(ObjectGuid(HIGHGUID_PLAYER, itr->first)))
-                    if (player != except)
-                        _do(player);
+            for (OnlineMemberMap::const_iterator itr = m_onlineMembers.begin(); itr != m_onlineMembers.end(); ++itr)
+                if (itr->second != except)
+                    _do(itr->second);
         }
 
         void CreateRank(std::string name, uint32 rights);
@@ -518,6 +527,14 @@ class Guild
 
         MemberList members;
 
+        // online members, maintained at login/logout and member add/remove
+        typedef std::unordered_map<uint32 /*lowguid*/, Player*> OnlineMemberMap;
+        OnlineMemberMap m_onlineMembers;
+        OnlineMemberMap m_onlineMembersByRank[GUILD_RANKS_MAX_COUNT];
+
+        WorldPacket m_rosterCache;
+        time_t m_rosterCacheTime;                           // 0 if m_rosterCache must be rebuilt
+
         typedef std::vector<GuildBankTab*> TabListMap;
         TabListMap m_TabListMap;
 
@@ -539,6 +556,10 @@ class Guild
     private:
         void UpdateAccountsNumber() { m_accountsNumber = 0;}// mark for lazy calculation at request in GetAccountsNumber
 
+        void AddOnlineMember(Player* player, uint32 rankId);
+        void RemoveOnlineMember(uint32 lowguid);
+        void BuildRoster(WorldPacket& data);
+
         // used only from high level Swap/Move functions
         Item*  GetItem(uint8 TabId, uint8 SlotId);
         InventoryResult CanStoreItem(uint8 tab, uint8 slot, GuildItemPosCountVec& dest, uint32 count, Item* pItem, bool swap = false) const;
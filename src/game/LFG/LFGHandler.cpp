@@ -136,15 +136,14 @@ void WorldSession::SendLfgSearchResults(LfgType type, uint32 entry)
         }
     }
 
-    // TODO: Guard Player map
-    HashMapHolder<Player>::MapType const& players = sObjectAccessor.GetPlayers();
+    HashMapHolder<Player>::SnapshotType players = sObjectAccessor.GetPlayersSnapshot();
     uint32 playersSize = players.size();
     data << uint32(playersSize);                            // players count
     data << uint32(playersSize);                            // players count (total?)
 
-    for (HashMapHolder<Player>::MapType::const_iterator iter = players.begin(); iter != players.end(); ++iter)
+    for (HashMapHolder<Player>::SnapshotType::const_iterator iter = players.begin(); iter != players.end(); ++iter)
     {
-        Player* plr = iter->second;
+        Player* plr = *iter;
 
         if (!plr || plr->GetTeam() != _player->GetTeam())
             continue;
@@ -31,6 +31,9 @@
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
 #endif
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+#include "PlayerBot/Base/PlayerbotAI.h"
+#endif
 
 INSTANTIATE_SINGLETON_1(LootMgr);
 
@@ -676,6 +679,15 @@ void GroupLootRoll::SendLootRollWon(ObjectGuid const& targetGuid, uint32 rollNum
         Player* plr = sObjectMgr.GetPlayer(itr->first);
         if (!plr || !plr->GetSession())
             continue;
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+        if (PlayerbotAI* ai = plr->GetPlayerbotAI())
+        {
+            PlayerbotEvent event(BOT_EVENT_LOOT_ROLL_WON, m_loot->GetLootGuid(), m_lootItem->itemId);
+            event.targetGuid = targetGuid;
+            ai->HandleBotEvent(event);
+            continue;
+        }
+#endif
         plr->GetSession()->SendPacket(data);
     }
 }
@@ -1127,6 +1139,14 @@ void Loot::SendReleaseFor(ObjectGuid const& guid)
 // no check for null pointer so it must be valid
 void Loot::SendReleaseFor(Player* plr)
 {
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    if (PlayerbotAI* ai = plr->GetPlayerbotAI())
+    {
+        SetPlayerIsNotLooting(plr);
+        ai->HandleBotEvent(PlayerbotEvent(BOT_EVENT_LOOT_RELEASED, m_guidTarget));
+        return;
+    }
+#endif
     WorldPacket data(SMSG_LOOT_RELEASE_RESPONSE, (8 + 1));
     data << m_guidTarget;
     data << uint8(1);
@@ -1423,6 +1443,21 @@ void Loot::ShowContentTo(Player* plr)
     }
 
 
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    // bots read the loot content directly, no need to serialize it
+    if (PlayerbotAI* ai = plr->GetPlayerbotAI())
+    {
+        SetPlayerIsLooting(plr);
+        if (m_lootTarget)
+            m_lootTarget->InspectingLoot();
+
+        PlayerbotEvent event(BOT_EVENT_LOOT_RESPONSE, m_guidTarget);
+        event.loot = this;
+        ai->HandleBotEvent(event);
+        return;
+    }
+#endif
+
     WorldPacket data(SMSG_LOOT_RESPONSE);
     data << m_guidTarget;
     data << uint8(m_clientLootType);
@@ -98,7 +98,7 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode)
       i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0),
       m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_persistentState(nullptr),
       m_activeNonPlayersIter(m_activeNonPlayers.end()),
-      i_gridExpiry(expiry), m_TerrainData(sTerrainMgr.LoadTerrain(id)),
+      i_gridExpiry(expiry), m_gridClock(0), m_gridExpiryTicket(0), m_TerrainData(sTerrainMgr.LoadTerrain(id)),
       i_data(nullptr), i_script_id(0)
 {
     m_CreatureGuids.Set(sObjectMgr.GetFirstTemporaryCreatureLowGuid());
@@ -236,15 +236,21 @@ void Map::DeleteFromWorld(Player* pl)
 void
 Map::EnsureGridCreated(const GridPair& p)
 {
+    // a grid that is partly unloaded can't be reused, finish its unload and start over
+    if (NGridType* grid = getNGrid(p.x_coord, p.y_coord))
+        if (grid->isUnloadInProgress())
+            UnloadGrid(p.x_coord, p.y_coord, true);
+
     if (!getNGrid(p.x_coord, p.y_coord))
     {
-        setNGrid(new NGridType(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, i_gridExpiry, sWorld.getConfig(CONFIG_BOOL_GRID_UNLOAD)),
+        setNGrid(new NGridType(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord, p.x_coord, p.y_coord, sWorld.getConfig(CONFIG_BOOL_GRID_UNLOAD)),
                  p.x_coord, p.y_coord);
 
         // build a linkage between this map and NGridType
         buildNGridLinkage(getNGrid(p.x_coord, p.y_coord));
 
         getNGrid(p.x_coord, p.y_coord)->SetGridState(GRID_STATE_IDLE);
+        ResetGridExpiry(*getNGrid(p.x_coord, p.y_coord), 0.0f);
 
         // z coord
         int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
@@ -297,11 +303,18 @@ bool Map::EnsureGridLoaded(const Cell& cell)
         // active object A(loaded with loader.LoadN call and added to the  map)
         // summons some active object B, while B added to map grid loading called again and so on..
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
+        uint32 startTime = WorldTimer::getMSTime();
         ObjectGridLoader loader(*grid, this, cell);
         loader.LoadN();
 
         // Add resurrectable corpses to world object list in grid
         sObjectAccessor.AddCorpsesToGrid(GridPair(cell.GridX(), cell.GridY()), (*grid)(cell.CellX(), cell.CellY()), this);
+
+        uint32 loadTime = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+        ++m_gridLoadStats.loadCount;
+        m_gridLoadStats.loadTimeTotal += loadTime;
+        m_gridLoadStats.loadTimeMax = std::max(m_gridLoadStats.loadTimeMax, loadTime);
+        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Loading grid[%u,%u] for map %u took %u ms", cell.GridX(), cell.GridY(), i_id, loadTime);
         return true;
     }
 
@@ -612,14 +625,8 @@ void Map::Update(const uint32& t_diff)
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattleGroundOrArena())
     {
-        for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
-        {
-            NGridType* grid = i->getSource();
-            GridInfo* info = i->getSource()->getGridInfoRef();
-            ++i;                                            // The update might delete the map and we need the next map before the iterator gets invalid
-            MANGOS_ASSERT(grid->GetGridState() >= 0 && grid->GetGridState() < MAX_GRID_STATE);
-            sMapMgr.UpdateGridState(grid->GetGridState(), *this, *grid, *info, grid->getX(), grid->getY(), t_diff);
-        }
+        UpdateGridExpiry(t_diff);
+        UpdateGridUnloads();
     }
 
     ///- Process necessary scripts
@@ -857,22 +864,42 @@ bool Map::UnloadGrid(const uint32& x, const uint32& y, bool pForce)
     NGridType* grid = getNGrid(x, y);
     MANGOS_ASSERT(grid != nullptr);
 
-    {
-        if (!pForce && ActiveObjectsNearGrid(x, y))
-            return false;
+    uint32 startTime = WorldTimer::getMSTime();
+    uint32 workTime = 0;
 
-        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u", x, y, i_id);
+    {
         ObjectGridUnloader unloader(*grid);
 
-        // Finish remove and delete all creatures with delayed remove before moving to respawn grids
-        // Must know real mob position before move
-        RemoveAllObjectsInRemoveList();
+        if (grid->isUnloadInProgress())
+        {
+            // respawn relocation was done when the unload started, only the remaining cells are left
+            for (std::deque<GridUnloadProgress>::iterator itr = m_gridUnloadQueue.begin(); itr != m_gridUnloadQueue.end(); ++itr)
+            {
+                if (itr->x == x && itr->y == y)
+                {
+                    workTime = itr->workTime;
+                    m_gridUnloadQueue.erase(itr);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            if (!pForce && ActiveObjectsNearGrid(x, y))
+                return false;
+
+            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u", x, y, i_id);
 
-        // move creatures to respawn grids if this is diff.grid or to remove list
-        unloader.MoveToRespawnN();
+            // Finish remove and delete all creatures with delayed remove before moving to respawn grids
+            // Must know real mob position before move
+            RemoveAllObjectsInRemoveList();
 
-        // Finish remove and delete all creatures with delayed remove before unload
-        RemoveAllObjectsInRemoveList();
+            // move creatures to respawn grids if this is diff.grid or to remove list
+            unloader.MoveToRespawnN();
+
+            // Finish remove and delete all creatures with delayed remove before unload
+            RemoveAllObjectsInRemoveList();
+        }
 
         unloader.UnloadN();
         delete getNGrid(x, y);
@@ -890,10 +917,107 @@ bool Map::UnloadGrid(const uint32& x, const uint32& y, bool pForce)
         m_TerrainData->Unload(gx, gy);
     }
 
-    DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u finished", x, y, i_id);
+    workTime += WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+    ++m_gridLoadStats.unloadCount;
+    m_gridLoadStats.unloadTimeTotal += workTime;
+    m_gridLoadStats.unloadTimeMax = std::max(m_gridLoadStats.unloadTimeMax, workTime);
+
+    DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u finished in %u ms", x, y, i_id, workTime);
+    return true;
+}
+
+bool Map::StartGridUnload(uint32 x, uint32 y)
+{
+    // without a budget the grid is unloaded at once
+    if (!sWorld.getConfig(CONFIG_UINT32_GRID_UNLOAD_BUDGET))
+        return UnloadGrid(x, y, false);
+
+    NGridType* grid = getNGrid(x, y);
+    MANGOS_ASSERT(grid != nullptr);
+
+    if (grid->isUnloadInProgress())
+        return true;
+
+    if (ActiveObjectsNearGrid(x, y))
+        return false;
+
+    DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Unloading grid[%u,%u] for map %u over several updates", x, y, i_id);
+    uint32 startTime = WorldTimer::getMSTime();
+
+    // relocation must see the whole grid, so it is done before the cells are unloaded one by one
+    ObjectGridUnloader unloader(*grid);
+    RemoveAllObjectsInRemoveList();
+    unloader.MoveToRespawnN();
+    RemoveAllObjectsInRemoveList();
+
+    // from now on the grid counts as not loaded, objects are not relocated into it anymore
+    grid->setGridObjectDataLoaded(false);
+    grid->setUnloadInProgress(true);
+
+    m_gridUnloadQueue.push_back(GridUnloadProgress(x, y, WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime())));
     return true;
 }
 
+void Map::UpdateGridUnloads()
+{
+    uint32 budget = sWorld.getConfig(CONFIG_UINT32_GRID_UNLOAD_BUDGET);
+    uint32 startTime = WorldTimer::getMSTime();
+
+    // at least one cell is unloaded per update so the queue always drains
+    while (!m_gridUnloadQueue.empty())
+    {
+        // no reference into the queue across the cell unload: deleting objects can re-enter EnsureGridCreated,
+        // which finishes the unload of this grid and removes its entry
+        uint32 const x = m_gridUnloadQueue.front().x;
+        uint32 const y = m_gridUnloadQueue.front().y;
+        uint32 const cell = m_gridUnloadQueue.front().nextCell;
+        uint32 cellStartTime = WorldTimer::getMSTime();
+
+        ObjectGridUnloader unloader(*getNGrid(x, y));
+        unloader.UnloadCell(cell / MAX_NUMBER_OF_CELLS, cell % MAX_NUMBER_OF_CELLS);
+
+        std::deque<GridUnloadProgress>::iterator progress = std::find_if(m_gridUnloadQueue.begin(), m_gridUnloadQueue.end(),
+            [x, y](GridUnloadProgress const& entry) { return entry.x == x && entry.y == y; });
+
+        // otherwise the unload was finished meanwhile
+        if (progress != m_gridUnloadQueue.end())
+        {
+            progress->workTime += WorldTimer::getMSTimeDiff(cellStartTime, WorldTimer::getMSTime());
+            if (++progress->nextCell >= MAX_NUMBER_OF_CELLS * MAX_NUMBER_OF_CELLS)
+                UnloadGrid(x, y, true);                     // removes the queue entry
+        }
+
+        if (WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime()) >= budget)
+            break;
+    }
+}
+
+void Map::ResetGridExpiry(NGridType& grid, float factor)
+{
+    uint32 ticket = ++m_gridExpiryTicket;
+    grid.getGridInfoRef()->setExpiryTicket(ticket);
+    m_gridExpiryQueue.push(GridExpiryEvent(m_gridClock + uint64((float)i_gridExpiry * factor), ticket, grid.getX(), grid.getY()));
+}
+
+void Map::UpdateGridExpiry(uint32 diff)
+{
+    m_gridClock += diff;
+
+    while (!m_gridExpiryQueue.empty() && m_gridExpiryQueue.top().expireTime <= m_gridClock)
+    {
+        GridExpiryEvent event = m_gridExpiryQueue.top();
+        m_gridExpiryQueue.pop();
+
+        // grid was unloaded or got a newer expiry since this one was queued
+        NGridType* grid = getNGrid(event.x, event.y);
+        if (!grid || grid->getGridInfoRef()->getExpiryTicket() != event.ticket)
+            continue;
+
+        MANGOS_ASSERT(grid->GetGridState() >= 0 && grid->GetGridState() < MAX_GRID_STATE);
+        sMapMgr.UpdateGridState(grid->GetGridState(), *this, *grid, *grid->getGridInfoRef(), event.x, event.y);
+    }
+}
+
 void Map::UnloadAll(bool pForce)
 {
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
@@ -1766,15 +1890,12 @@ bool Map::ScriptsStart(ScriptMapMapName const& scripts, uint32 id, Object* sourc
 
     if (execParams)                                         // Check if the execution should be uniquely
     {
-        for (ScriptScheduleMap::const_iterator searchItr = m_scriptSchedule.begin(); searchItr != m_scriptSchedule.end(); ++searchItr)
+        if (m_scriptSchedule.IsScheduled(scripts.first, id,
+                                         execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE ? sourceGuid : ObjectGuid(),
+                                         execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET ? targetGuid : ObjectGuid(), ownerGuid))
         {
-            if (searchItr->second.IsSameScript(scripts.first, id,
-                                               execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE ? sourceGuid : ObjectGuid(),
-                                               execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET ? targetGuid : ObjectGuid(), ownerGuid))
-            {
-                DEBUG_LOG("DB-SCRIPTS: Process table `%s` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", scripts.first, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
-                return true;
-            }
+            DEBUG_LOG("DB-SCRIPTS: Process table `%s` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", scripts.first, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
+            return true;
         }
     }
 
@@ -1784,7 +1905,7 @@ bool Map::ScriptsStart(ScriptMapMapName const& scripts, uint32 id, Object* sourc
     {
         ScriptAction sa(scripts.first, this, sourceGuid, targetGuid, ownerGuid, &iter->second);
 
-        m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + iter->first), sa));
+        m_scriptSchedule.Add(time_t(sWorld.GetGameTime() + iter->first), sa);
 
         sScriptMgr.IncreaseScheduledScriptsCount();
     }
@@ -1803,7 +1924,7 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
 
     ScriptAction sa("Internal Activate Command used for spell", this, sourceGuid, targetGuid, ownerGuid, &script);
 
-    m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + delay), sa));
+    m_scriptSchedule.Add(time_t(sWorld.GetGameTime() + delay), sa);
 
     sScriptMgr.IncreaseScheduledScriptsCount();
 }
@@ -1815,37 +1936,19 @@ void Map::ScriptsProcess()
         return;
 
     ///- Process overdue queued scripts
-    ScriptScheduleMap::iterator iter = m_scriptSchedule.begin();
-    // ok as multimap is a *sorted* associative container
-    while (!m_scriptSchedule.empty() && (iter->first <= sWorld.GetGameTime()))
+    uint64 sequence;
+    while (ScriptAction const* action = m_scriptSchedule.GetNextDue(sWorld.GetGameTime(), sequence))
     {
-        if (iter->second.HandleScriptStep())
+        // executed from a copy, the step can start new scripts which may modify the schedule
+        ScriptAction step = *action;
+
+        if (step.HandleScriptStep())
         {
             // Terminate following script steps of this script
-            const char* tableName = iter->second.GetTableName();
-            uint32 id = iter->second.GetId();
-            ObjectGuid sourceGuid = iter->second.GetSourceGuid();
-            ObjectGuid targetGuid = iter->second.GetTargetGuid();
-            ObjectGuid ownerGuid = iter->second.GetOwnerGuid();
-
-            for (ScriptScheduleMap::iterator rmItr = m_scriptSchedule.begin(); rmItr != m_scriptSchedule.end();)
-            {
-                if (rmItr->second.IsSameScript(tableName, id, sourceGuid, targetGuid, ownerGuid))
-                {
-                    m_scriptSchedule.erase(rmItr++);
-                    sScriptMgr.DecreaseScheduledScriptCount();
-                }
-                else
-                    ++rmItr;
-            }
+            sScriptMgr.DecreaseScheduledScriptCount(m_scriptSchedule.Terminate(step.GetTableName(), step.GetId(), step.GetSourceGuid(), step.GetTargetGuid(), step.GetOwnerGuid()));
         }
-        else
-        {
-            m_scriptSchedule.erase(iter);
-
+        else if (m_scriptSchedule.Remove(sequence))
             sScriptMgr.DecreaseScheduledScriptCount();
-        }
-        iter = m_scriptSchedule.begin();
     }
 }
 
@@ -1988,7 +2091,7 @@ void Map::SendObjectUpdates()
         obj->BuildUpdateData(update_players);
     }
 
-    WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
+    WorldPacket packet;                                     // storage is reserved by the first BuildPacket and reused for all players
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
         iter->second.BuildPacket(packet);
@@ -32,6 +32,7 @@
 #include "GameSystem/GridRefManager.h"
 #include "MapRefManager.h"
 #include "DBScripts/ScriptMgr.h"
+#include "DBScripts/ScriptSchedule.h"
 #include "Entities/CreatureLinkingMgr.h"
 #include "Util/UniqueTrackablePtr.h"
 #include "Vmap/DynamicTree.h"
@@ -41,6 +42,8 @@
 #endif
 
 #include <bitset>
+#include <deque>
+#include <queue>
 
 struct CreatureInfo;
 class Creature;
@@ -160,14 +163,28 @@ class Map : public GridRefManager<NGridType>
         void SetUnloadLock(const GridPair& p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadExplicitLock(on); }
         void ForceLoadGrid(float x, float y);
         bool UnloadGrid(const uint32& x, const uint32& y, bool pForce);
+        bool StartGridUnload(uint32 x, uint32 y);
         virtual void UnloadAll(bool pForce);
 
-        void ResetGridExpiry(NGridType& grid, float factor = 1) const
-        {
-            grid.ResetTimeTracker((time_t)((float)i_gridExpiry * factor));
-        }
+        // schedules the next grid state update of the grid, replacing any earlier one
+        void ResetGridExpiry(NGridType& grid, float factor = 1);
 
         time_t GetGridExpiry(void) const { return i_gridExpiry; }
+
+        struct GridLoadStats
+        {
+            GridLoadStats() : loadCount(0), loadTimeMax(0), loadTimeTotal(0), unloadCount(0), unloadTimeMax(0), unloadTimeTotal(0) {}
+
+            uint32 loadCount;
+            uint32 loadTimeMax;                             // in milliseconds
+            uint64 loadTimeTotal;
+            uint32 unloadCount;
+            uint32 unloadTimeMax;                           // work time only, sliced unloads span several updates
+            uint64 unloadTimeTotal;
+        };
+
+        GridLoadStats const& GetGridLoadStats() const { return m_gridLoadStats; }
+        uint32 GetPendingGridUnloadCount() const { return uint32(m_gridUnloadQueue.size()); }
         uint32 GetId(void) const { return i_id; }
 
         // some calls like isInWater should not use vmaps due to processor power
@@ -369,6 +386,8 @@ class Map : public GridRefManager<NGridType>
         void setGridObjectDataLoaded(bool pLoaded, uint32 x, uint32 y) { getNGrid(x, y)->setGridObjectDataLoaded(pLoaded); }
 
         void setNGrid(NGridType* grid, uint32 x, uint32 y);
+        void UpdateGridExpiry(uint32 diff);
+        void UpdateGridUnloads();
         void ScriptsProcess();
 
         void SendObjectUpdates();
@@ -401,6 +420,34 @@ class Map : public GridRefManager<NGridType>
     private:
         time_t i_gridExpiry;
 
+        struct GridExpiryEvent
+        {
+            GridExpiryEvent(uint64 _expireTime, uint32 _ticket, uint32 _x, uint32 _y) : expireTime(_expireTime), ticket(_ticket), x(_x), y(_y) {}
+
+            bool operator>(GridExpiryEvent const& other) const { return expireTime > other.expireTime; }
+
+            uint64 expireTime;
+            uint32 ticket;
+            uint32 x;
+            uint32 y;
+        };
+
+        struct GridUnloadProgress
+        {
+            GridUnloadProgress(uint32 _x, uint32 _y, uint32 _workTime) : x(_x), y(_y), nextCell(0), workTime(_workTime) {}
+
+            uint32 x;
+            uint32 y;
+            uint32 nextCell;
+            uint32 workTime;
+        };
+
+        std::priority_queue<GridExpiryEvent, std::vector<GridExpiryEvent>, std::greater<GridExpiryEvent> > m_gridExpiryQueue;
+        uint64 m_gridClock;                                 // sum of update diffs, grid expiry times are relative to it
+        uint32 m_gridExpiryTicket;
+        std::deque<GridUnloadProgress> m_gridUnloadQueue;
+        GridLoadStats m_gridLoadStats;
+
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
         // Shared geodata object with map coord info...
@@ -411,8 +458,7 @@ class Map : public GridRefManager<NGridType>
 
         std::set<WorldObject*> i_objectsToRemove;
 
-        typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
-        ScriptScheduleMap m_scriptSchedule;
+        ScriptSchedule m_scriptSchedule;
 
         InstanceData* i_data;
         uint32 i_script_id;
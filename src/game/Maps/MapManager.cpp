@@ -75,13 +75,13 @@ void MapManager::DeleteStateMachine()
     delete si_GridStates[GRID_STATE_REMOVAL];
 }
 
-void MapManager::UpdateGridState(grid_state_t state, Map& map, NGridType& ngrid, GridInfo& ginfo, const uint32& x, const uint32& y, const uint32& t_diff)
+void MapManager::UpdateGridState(grid_state_t state, Map& map, NGridType& ngrid, GridInfo& ginfo, const uint32& x, const uint32& y)
 {
     // TODO: The grid state array itself is static and therefore 100% safe, however, the data
     // the state classes in it accesses is not, since grids are shared across maps (for example
     // in instances), so some sort of locking will be necessary later.
 
-    si_GridStates[state]->Update(map, ngrid, ginfo, x, y, t_diff);
+    si_GridStates[state]->Update(map, ngrid, ginfo, x, y);
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
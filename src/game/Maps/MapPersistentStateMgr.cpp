@@ -77,21 +77,7 @@ void MapPersistentState::SaveCreatureRespawnTime(uint32 loguid, time_t t)
     if (GetMapEntry()->IsBattleGroundOrArena())
         return;
 
-    CharacterDatabase.BeginTransaction();
-
-    static SqlStatementID delSpawnTime ;
-    static SqlStatementID insSpawnTime ;
-
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delSpawnTime, "DELETE FROM creature_respawn WHERE guid = ? AND instance = ?");
-    stmt.PExecute(loguid, m_instanceid);
-
-    if (t > sWorld.GetGameTime())
-    {
-        stmt = CharacterDatabase.CreateStatement(insSpawnTime, "INSERT INTO creature_respawn VALUES ( ?, ?, ? )");
-        stmt.PExecute(loguid, uint64(t), m_instanceid);
-    }
-
-    CharacterDatabase.CommitTransaction();
+    sMapPersistentStateMgr.QueueCreatureRespawnTime(loguid, m_instanceid, t);
 }
 
 void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
@@ -102,21 +88,7 @@ void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
     if (GetMapEntry()->IsBattleGroundOrArena())
         return;
 
-    CharacterDatabase.BeginTransaction();
-
-    static SqlStatementID delSpawnTime ;
-    static SqlStatementID insSpawnTime ;
-
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delSpawnTime, "DELETE FROM gameobject_respawn WHERE guid = ? AND instance = ?");
-    stmt.PExecute(loguid, m_instanceid);
-
-    if (t > sWorld.GetGameTime())
-    {
-        stmt = CharacterDatabase.CreateStatement(insSpawnTime, "INSERT INTO gameobject_respawn VALUES ( ?, ?, ? )");
-        stmt.PExecute(loguid, uint64(t), m_instanceid);
-    }
-
-    CharacterDatabase.CommitTransaction();
+    sMapPersistentStateMgr.QueueGORespawnTime(loguid, m_instanceid, t);
 }
 
 void MapPersistentState::SetCreatureRespawnTime(uint32 loguid, time_t t)
@@ -261,6 +233,9 @@ void DungeonPersistentState::SaveToDB()
 
 void DungeonPersistentState::DeleteRespawnTimes()
 {
+    // not yet written respawn times must not resurrect rows after the delete
+    sMapPersistentStateMgr.DiscardQueuedRespawnTimes(GetInstanceId());
+
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM creature_respawn WHERE instance = '%u'", GetInstanceId());
     CharacterDatabase.PExecute("DELETE FROM gameobject_respawn WHERE instance = '%u'", GetInstanceId());
@@ -708,6 +683,8 @@ void MapPersistentStateManager::DeleteInstanceFromDB(uint32 instanceid)
 {
     if (instanceid)
     {
+        sMapPersistentStateMgr.DiscardQueuedRespawnTimes(instanceid);
+
         CharacterDatabase.BeginTransaction();
         CharacterDatabase.PExecute("DELETE FROM instance WHERE id = '%u'", instanceid);
         CharacterDatabase.PExecute("DELETE FROM character_instance WHERE instance = '%u'", instanceid);
@@ -948,6 +925,9 @@ void MapPersistentStateManager::_ResetOrWarnAll(uint32 mapid, Difficulty difficu
         MapPersistantStateResetWorker worker;
         sMapMgr.DoForAllMapsWithMapId(mapid, worker);
 
+        // write out everything queued so far, the global reset must be applied after it
+        FlushRespawnTimes();
+
         // delete them from the DB, even if not loaded
         CharacterDatabase.BeginTransaction();
         CharacterDatabase.PExecute("DELETE FROM character_instance USING character_instance LEFT JOIN instance ON character_instance.instance = id WHERE map = '%u'", mapid);
@@ -985,6 +965,117 @@ void MapPersistentStateManager::GetStatistics(uint32& numStates, uint32& numBoun
     }
 }
 
+void MapPersistentStateManager::Update(uint32 diff)
+{
+    m_Scheduler.Update();
+
+    m_respawnSaveTimer.SetInterval(sWorld.getConfig(CONFIG_UINT32_INTERVAL_RESPAWN_SAVE));
+    m_respawnSaveTimer.Update(diff);
+    if (m_respawnSaveTimer.Passed())
+    {
+        m_respawnSaveTimer.SetCurrent(0);
+        FlushRespawnTimes();
+    }
+}
+
+/*
+- respawn times are not written at once but merged per (guid, instance) and
+- stored in batches by FlushRespawnTimes, a time in the past means "delete"
+*/
+void MapPersistentStateManager::QueueCreatureRespawnTime(uint32 loguid, uint32 instanceId, time_t t)
+{
+    m_pendingCreatureRespawnTimes[MAKE_PAIR64(loguid, instanceId)] = t;
+}
+
+void MapPersistentStateManager::QueueGORespawnTime(uint32 loguid, uint32 instanceId, time_t t)
+{
+    m_pendingGORespawnTimes[MAKE_PAIR64(loguid, instanceId)] = t;
+}
+
+void MapPersistentStateManager::DiscardQueuedRespawnTimes(uint32 instanceId)
+{
+    for (PendingRespawnTimes* pending : { &m_pendingCreatureRespawnTimes, &m_pendingGORespawnTimes })
+    {
+        for (PendingRespawnTimes::iterator itr = pending->begin(); itr != pending->end();)
+        {
+            if (PAIR64_HIPART(itr->first) == instanceId)
+                itr = pending->erase(itr);
+            else
+                ++itr;
+        }
+    }
+}
+
+void MapPersistentStateManager::FlushRespawnTimes()
+{
+    if (m_pendingCreatureRespawnTimes.empty() && m_pendingGORespawnTimes.empty())
+        return;
+
+    CharacterDatabase.BeginTransaction();
+    _FlushRespawnTimes(m_pendingCreatureRespawnTimes, "creature_respawn");
+    _FlushRespawnTimes(m_pendingGORespawnTimes, "gameobject_respawn");
+    CharacterDatabase.CommitTransaction();
+}
+
+void MapPersistentStateManager::_FlushRespawnTimes(PendingRespawnTimes& pending, char const* table)
+{
+    // keep single statements well below max_allowed_packet
+    static uint32 const maxRowsPerQuery = 1000;
+
+    time_t now = sWorld.GetGameTime();
+
+    std::map<uint32 /*instanceId*/, std::vector<uint32> /*guids*/> deletes;
+    std::ostringstream replaceSql;
+    uint32 replaceRows = 0;
+
+    for (PendingRespawnTimes::const_iterator itr = pending.begin(); itr != pending.end(); ++itr)
+    {
+        uint32 loguid = PAIR64_LOPART(itr->first);
+        uint32 instanceId = PAIR64_HIPART(itr->first);
+
+        if (itr->second <= now)
+        {
+            deletes[instanceId].push_back(loguid);
+            continue;
+        }
+
+        if (!replaceRows)
+            replaceSql << "REPLACE INTO " << table << " (guid, respawntime, instance) VALUES ";
+        else
+            replaceSql << ",";
+
+        replaceSql << "(" << loguid << "," << uint64(itr->second) << "," << instanceId << ")";
+
+        if (++replaceRows >= maxRowsPerQuery)
+        {
+            CharacterDatabase.Execute(replaceSql.str().c_str());
+            replaceSql.str("");
+            replaceRows = 0;
+        }
+    }
+
+    if (replaceRows)
+        CharacterDatabase.Execute(replaceSql.str().c_str());
+
+    for (auto& del : deletes)
+    {
+        for (size_t i = 0; i < del.second.size(); i += maxRowsPerQuery)
+        {
+            std::ostringstream deleteSql;
+            deleteSql << "DELETE FROM " << table << " WHERE instance = " << del.first << " AND guid IN (";
+
+            size_t end = std::min(del.second.size(), i + maxRowsPerQuery);
+            for (size_t j = i; j < end; ++j)
+                deleteSql << (j != i ? "," : "") << del.second[j];
+
+            deleteSql << ")";
+            CharacterDatabase.Execute(deleteSql.str().c_str());
+        }
+    }
+
+    pending.clear();
+}
+
 void MapPersistentStateManager::_CleanupExpiredInstancesAtTime(time_t t)
 {
     _DelHelper(CharacterDatabase, "id, map, instance.difficulty", "instance", "LEFT JOIN instance_reset ON mapid = map AND instance.difficulty =  instance_reset.difficulty WHERE (instance.resettime < '" UI64FMTD "' AND instance.resettime > '0') OR (NOT instance_reset.resettime IS NULL AND instance_reset.resettime < '" UI64FMTD "')", (uint64)t, (uint64)t);
@@ -26,6 +26,7 @@
 #include "Server/DBCStores.h"
 #include "Entities/ObjectGuid.h"
 #include "Pools/PoolManager.h"
+#include "Util/Timer.h"
 
 #include <list>
 #include <map>
@@ -371,9 +372,19 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
 
         void GetStatistics(uint32& numStates, uint32& numBoundPlayers, uint32& numBoundGroups);
 
-        void Update() { m_Scheduler.Update(); }
+        void Update(uint32 diff);
+
+    public:                                                 // respawn times write-behind buffer
+        void QueueCreatureRespawnTime(uint32 loguid, uint32 instanceId, time_t t);
+        void QueueGORespawnTime(uint32 loguid, uint32 instanceId, time_t t);
+        // drop not yet written respawn times of an instance that is reset or deleted
+        void DiscardQueuedRespawnTimes(uint32 instanceId);
+        // write all queued respawn times in one transaction, called periodically and at shutdown
+        void FlushRespawnTimes();
+
     private:
         typedef std::unordered_map<uint32 /*InstanceId or MapId*/, MapPersistentState*> PersistentStateMap;
+        typedef std::unordered_map<uint64 /*PAIR64(loguid, instanceId)*/, time_t /*respawnTime*/> PendingRespawnTimes;
 
         //  called by scheduler for DungeonPersistentStates
         void _ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool warn, uint32 timeleft);
@@ -382,6 +393,7 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
 
         void _ResetSave(PersistentStateMap& holder, PersistentStateMap::iterator& itr);
         void _DelHelper(DatabaseType& db, const char* fields, const char* table, const char* queryTail, ...);
+        void _FlushRespawnTimes(PendingRespawnTimes& pending, char const* table);
 
         // used during global instance resets
         bool lock_instLists;
@@ -391,6 +403,11 @@ class MapPersistentStateManager : public MaNGOS::Singleton<MapPersistentStateMan
         PersistentStateMap m_instanceSaveByMapId;
 
         DungeonResetScheduler m_Scheduler;
+
+        // respawn times waiting for the next batched write
+        PendingRespawnTimes m_pendingCreatureRespawnTimes;
+        PendingRespawnTimes m_pendingGORespawnTimes;
+        ShortIntervalTimer m_respawnSaveTimer;
 };
 
 template<typename Do>
@@ -1538,54 +1538,12 @@ void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
 {
     switch (packet.GetOpcode())
     {
+    // the winner is announced to everyone around, spectating bots applaud as well as the duelists
     case SMSG_DUEL_WINNER:
         {
-            m_bot->HandleEmoteCommand(EMOTE_ONESHOT_APPLAUD);
-            return;
-        }
-    case SMSG_DUEL_COMPLETE:
-        {
-            SetIgnoreUpdateTime(4);
-            m_ScenarioType = SCENARIO_PVE;
-            ReloadAI();
-            m_bot->GetMotionMaster()->Clear(true);
+            HandleBotEvent(PlayerbotEvent(BOT_EVENT_DUEL_WINNER));
             return;
         }
-    case SMSG_DUEL_OUTOFBOUNDS:
-        {
-            m_bot->HandleEmoteCommand(EMOTE_ONESHOT_CHICKEN);
-            return;
-        }
-    case SMSG_DUEL_REQUESTED:
-        {
-            SetIgnoreUpdateTime(0);
-            WorldPacket p(packet);
-            ObjectGuid flagGuid;
-            p >> flagGuid;
-            ObjectGuid playerGuid;
-            p >> playerGuid;
-            Player* const pPlayer = ObjectAccessor::FindPlayer(playerGuid);
-            if (canObeyCommandFrom(*pPlayer))
-            {
-                m_bot->GetMotionMaster()->Clear(true);
-                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_DUEL_ACCEPTED, 8));
-                *packet << flagGuid;
-                m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
-
-                // follow target in casting range
-                float angle = rand_float(0, M_PI_F);
-                float dist = rand_float(4, 10);
-
-                m_bot->GetMotionMaster()->Clear(true);
-                m_bot->GetMotionMaster()->MoveFollow(pPlayer, dist, angle);
-
-                m_bot->SetSelectionGuid(ObjectGuid(playerGuid));
-                SetIgnoreUpdateTime(4);
-                m_ScenarioType = SCENARIO_PVP_DUEL;
-            }
-            return;
-        }
-
     case SMSG_PET_TAME_FAILURE:
         {
             // DEBUG_LOG("SMSG_PET_TAME_FAILURE");
@@ -2016,20 +1974,244 @@ void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
             return;
         }
 
-        // Handle chat messages here
-    case SMSG_MESSAGECHAT:
+        case SMSG_GUILD_INVITE:
+        {
+            Guild *guild = sGuildMgr.GetGuildById(m_bot->GetGuildIdInvited());
+            if (!guild || m_bot->GetGuildId())
+                return;
+
+            // not let enemies sign guild charter
+            if (!sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GUILD) && m_bot->GetTeam() != sObjectMgr.GetPlayerTeamByGUID(guild->GetLeaderGuid()))
+                return;
+
+            if (!guild->AddMember(m_bot->GetObjectGuid(),guild->GetLowestRank()))
+                return;
+            // Put record into guild log
+            guild->LogGuildEvent(GUILD_EVENT_LOG_JOIN_GUILD, m_bot->GetObjectGuid());
+
+            guild->BroadcastEvent(GE_JOINED, m_bot->GetObjectGuid(), m_bot->GetName());
+            return;
+        }
+
+    case SMSG_SPELL_START:
         {
             WorldPacket p(packet);
-            uint8 msgtype;
-            uint32 language;
 
-            p >> msgtype;           // 1 type
-            p >> language;          // 4 language
+            ObjectGuid castItemGuid;
+            p >> castItemGuid.ReadAsPacked();
+            ObjectGuid casterGuid;
+            p >> casterGuid.ReadAsPacked();
+            if (casterGuid != m_bot->GetObjectGuid())
+                return;
+
+            uint8 castCount;
+            p >> castCount;
+            uint32 spellId;
+            p >> spellId;
+            uint32 castFlags;
+            p >> castFlags;
+            uint32 msTime;
+            p >> msTime;
+
+            const SpellEntry* const pSpellInfo = sSpellTemplate.LookupEntry<SpellEntry>(spellId);
+            if (!pSpellInfo)
+                return;
+
+            if (pSpellInfo->AuraInterruptFlags & AURA_INTERRUPT_FLAG_NOT_SEATED)
+                return;
+
+            SetIgnoreUpdateTime((msTime / 1000) + 1);
+
+            return;
+        }
+
+    case SMSG_SPELL_GO:
+        {
+            WorldPacket p(packet);
+
+            ObjectGuid castItemGuid;
+            p >> castItemGuid.ReadAsPacked();
+            ObjectGuid casterGuid;
+            p >> casterGuid.ReadAsPacked();
+            if (casterGuid != m_bot->GetObjectGuid())
+                return;
+
+            uint8 castCount;
+            p >> castCount;
+            uint32 spellId;
+            p >> spellId;
+            uint32 castFlags;
+            p >> castFlags;
+            uint32 msTime;
+            p >> msTime;
+
+            return;
+        }
+
+        // if someone tries to resurrect, then accept
+    case SMSG_RESURRECT_REQUEST:
+        {
+            if (!m_bot->IsAlive())
+            {
+                WorldPacket p(packet);
+                ObjectGuid guid;
+                p >> guid;
+
+                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_RESURRECT_RESPONSE, 8 + 1));
+                *packet << guid;
+                *packet << uint8(1);                        // accept
+                m_bot->GetSession()->QueuePacket(std::move(packet));   // queue the packet to get around race condition
+
+                // set back to normal
+                SetState(BOTSTATE_NORMAL);
+                SetIgnoreUpdateTime(0);
+            }
+            return;
+        }
+
+    case SMSG_PARTYKILLLOG:
+        {
+            // reset AI delay so bots immediately respond to next combat target & or looting/skinning
+            SetIgnoreUpdateTime(0);
+            return;
+        }
+
+    case SMSG_ITEM_PUSH_RESULT:
+        {
+            WorldPacket p(packet);  // (8+4+4+4+1+4+4+4+4+4+4)
+            ObjectGuid guid;
+
+            p >> guid;              // 8 player guid
+            if (m_bot->GetObjectGuid() != guid)
+                return;
+
+            uint8 bagslot;
+            uint32 itemslot, itemid, count, totalcount, received, created;
+
+            p >> received;          // 4 0=looted, 1=from npc
+            p >> created;           // 4 0=received, 1=created
+            p.read_skip<uint32>();  // 4 IsShowChatMessage
+            p >> bagslot;           // 1 bagslot
+            p >> itemslot;          // 4 item slot, but when added to stack: 0xFFFFFFFF
+            p >> itemid;            // 4 item entry id
+            p.read_skip<uint32>();  // 4 SuffixFactor
+            p.read_skip<uint32>();  // 4 random item property id
+            p >> count;             // 4 count of items
+            p >> totalcount;        // 4 count of items in inventory
+
+            ItemPrototype const *pProto = ObjectMgr::GetItemPrototype(itemid);
+            if (pProto)
+            {
+                std::ostringstream out;
+                if (received == 1)
+                {
+                    if (created == 1)
+                        out << "|cff009900" << "I created: |r";
+                    else
+                        out << "|cff009900" << "I received: |r";
+                    MakeItemLink(pProto, out);
+                    TellMaster(out.str().c_str());
+                    SetState(BOTSTATE_DELAYED);
+                }
+            }
+
+            if (IsInQuestItemList(itemid))
+            {
+                m_needItemList[itemid] = (m_needItemList[itemid] - count);
+                if (m_needItemList[itemid] <= 0)
+                    m_needItemList.erase(itemid);
+            }
+
+            return;
+        }
+
+        /* uncomment this and your bots will tell you all their outgoing packet opcode names
+        case SMSG_MONSTER_MOVE:
+        case SMSG_UPDATE_WORLD_STATE:
+        case SMSG_COMPRESSED_UPDATE_OBJECT:
+        case MSG_MOVE_SET_FACING:
+        case MSG_MOVE_STOP:
+        case MSG_MOVE_HEARTBEAT:
+        case MSG_MOVE_STOP_STRAFE:
+        case MSG_MOVE_START_STRAFE_LEFT:
+        case SMSG_UPDATE_OBJECT:
+        case MSG_MOVE_START_FORWARD:
+        case MSG_MOVE_START_STRAFE_RIGHT:
+        case SMSG_DESTROY_OBJECT:
+        case MSG_MOVE_START_BACKWARD:
+        case SMSG_AURA_UPDATE_ALL:
+        case MSG_MOVE_FALL_LAND:
+        case MSG_MOVE_JUMP:
+        return;*/
+
+    default:
+        {
+            /*const char* oc = LookupOpcodeName(packet.GetOpcode());
+
+            std::ostringstream out;
+            out << "botout: " << oc;
+            sLog.outError(out.str().c_str());
+
+            TellMaster(oc);*/
+        }
+    }
+}
+
+// handle events the game code delivers directly to the bot
+void PlayerbotAI::HandleBotEvent(const PlayerbotEvent& event)
+{
+    switch (event.type)
+    {
+    case BOT_EVENT_DUEL_WINNER:
+        {
+            m_bot->HandleEmoteCommand(EMOTE_ONESHOT_APPLAUD);
+            return;
+        }
+    case BOT_EVENT_DUEL_COMPLETE:
+        {
+            SetIgnoreUpdateTime(4);
+            m_ScenarioType = SCENARIO_PVE;
+            ReloadAI();
+            m_bot->GetMotionMaster()->Clear(true);
+            return;
+        }
+    case BOT_EVENT_DUEL_OUT_OF_BOUNDS:
+        {
+            m_bot->HandleEmoteCommand(EMOTE_ONESHOT_CHICKEN);
+            return;
+        }
+    case BOT_EVENT_DUEL_REQUESTED:
+        {
+            SetIgnoreUpdateTime(0);
+            Player* const pPlayer = ObjectAccessor::FindPlayer(event.guid);
+            if (pPlayer && canObeyCommandFrom(*pPlayer))
+            {
+                m_bot->GetMotionMaster()->Clear(true);
+                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_DUEL_ACCEPTED, 8));
+                *packet << event.targetGuid;
+                m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
+
+                // follow target in casting range
+                float angle = rand_float(0, M_PI_F);
+                float dist = rand_float(4, 10);
+
+                m_bot->GetMotionMaster()->Clear(true);
+                m_bot->GetMotionMaster()->MoveFollow(pPlayer, dist, angle);
+
+                m_bot->SetSelectionGuid(event.guid);
+                SetIgnoreUpdateTime(4);
+                m_ScenarioType = SCENARIO_PVP_DUEL;
+            }
+            return;
+        }
 
-            if (language == LANG_ADDON)
+        // Handle chat messages here
+    case BOT_EVENT_CHAT:
+        {
+            if (event.value2 == LANG_ADDON)
                 return;
 
-            switch (msgtype)
+            switch (event.value)
             {
                 case CHAT_MSG_RAID:
                 case CHAT_MSG_RAID_LEADER:
@@ -2037,147 +2219,105 @@ void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
                 case CHAT_MSG_PARTY_LEADER:
                 case CHAT_MSG_WHISPER:
                 {
-                    ObjectGuid senderGuid;
-                    std::string channelName;
-                    uint32 length;
-                    std::string text;
-                    uint8 chattag;
-
-                    p >> senderGuid;        // 8 player from guid
-                    p.read_skip<uint32>();  // 4 chat msg group
-                    p.read_skip<uint64>();  // 8 player from guid
-                    p >> length;            // 4 length of text
-                    p >> text;              // string message
-                    p >> chattag;           // 1 AFK/DND/WHISPER_INFORM
-
-                    Player *sender = sObjectMgr.GetPlayer(senderGuid);
+                    Player *sender = sObjectMgr.GetPlayer(event.guid);
                     if (!sender)            // couldn't find player that sent message
                         return;
 
                     // do not listen to other bots
                     if (sender != m_bot && sender->GetPlayerbotAI())
                         return;
-                    HandleCommand(text, *sender);
+                    HandleCommand(event.text, *sender);
                     return;
                 }
                 default:
                     return;
             }
-
-            return;
         }
 
         // If the leader role was given to the bot automatically give it to the master
         // if the master is in the group, otherwise leave group
-    case SMSG_GROUP_SET_LEADER:
+    case BOT_EVENT_GROUP_SET_LEADER:
         {
-            WorldPacket p(packet);
-            std::string name;
-            p >> name;
-            if (m_bot->GetGroup() && name == m_bot->GetName())
+            if (m_bot->GetGroup() && event.guid == m_bot->GetObjectGuid())
             {
                 if (m_bot->GetGroup()->IsMember(GetMaster()->GetObjectGuid()))
                 {
-                    p.resize(8);
-                    p << GetMaster()->GetObjectGuid();
-                    m_bot->GetSession()->HandleGroupSetLeaderOpcode(p);
+                    std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_GROUP_SET_LEADER, 8));
+                    *packet << GetMaster()->GetObjectGuid();
+                    m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
                 }
                 else
                 {
-                    p.clear(); // not really needed
-                    m_bot->GetSession()->HandleGroupDisbandOpcode(p); // packet not used updated code
+                    std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_GROUP_DISBAND, 0));
+                    m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
                 }
             }
             return;
         }
 
         // If the master leaves the group, then the bot leaves too
-    case SMSG_PARTY_COMMAND_RESULT:
+    case BOT_EVENT_PARTY_RESULT:
         {
-            WorldPacket p(packet);
-            uint32 operation;
-            p >> operation;
-            std::string member;
-            p >> member;
-            uint32 result;
-            p >> result;
-            p.clear();
-            if (operation == PARTY_OP_LEAVE)
-                if (member == GetMaster()->GetName())
-                    m_bot->GetSession()->HandleGroupDisbandOpcode(p);  // packet not used updated code
-            return;
-        }
-
-        // Handle Group invites (auto accept if master is in group, otherwise decline & send message
-    case SMSG_GROUP_INVITE:
-        {
-            if (m_bot->GetGroupInvite())
+            if (event.value == PARTY_OP_LEAVE && event.text == GetMaster()->GetName())
             {
-                const Group* const grp = m_bot->GetGroupInvite();
-                if (!grp)
-                    return;
-
-                Player* const inviter = sObjectMgr.GetPlayer(grp->GetLeaderGuid());
-                if (!inviter)
-                    return;
-
-                WorldPacket p;
-                if (!canObeyCommandFrom(*inviter))
-                {
-                    std::string buf = "I can't accept your invite unless you first invite my master ";
-                    buf += GetMaster()->GetName();
-                    buf += ".";
-                    SendWhisper(buf, *inviter);
-                    m_bot->GetSession()->HandleGroupInviteResponseOpcode(p); // packet not used
-                }
-                else
-                    m_bot->GetSession()->HandleGroupInviteResponseOpcode(p);  // packet not used
+                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_GROUP_DISBAND, 0));
+                m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
             }
             return;
         }
 
-        case SMSG_GUILD_INVITE:
+        // Handle Group invites (auto accept if master is in group, otherwise decline & send message
+    case BOT_EVENT_GROUP_INVITE:
         {
-            Guild *guild = sGuildMgr.GetGuildById(m_bot->GetGuildIdInvited());
-            if (!guild || m_bot->GetGuildId())
+            const Group* const grp = m_bot->GetGroupInvite();
+            if (!grp)
                 return;
 
-            // not let enemies sign guild charter
-            if (!sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GUILD) && m_bot->GetTeam() != sObjectMgr.GetPlayerTeamByGUID(guild->GetLeaderGuid()))
+            Player* const inviter = sObjectMgr.GetPlayer(grp->GetLeaderGuid());
+            if (!inviter)
                 return;
 
-            if (!guild->AddMember(m_bot->GetObjectGuid(),guild->GetLowestRank()))
-                return;
-            // Put record into guild log
-            guild->LogGuildEvent(GUILD_EVENT_LOG_JOIN_GUILD, m_bot->GetObjectGuid());
+            bool accept = canObeyCommandFrom(*inviter);
+            if (!accept)
+            {
+                std::string buf = "I can't accept your invite unless you first invite my master ";
+                buf += GetMaster()->GetName();
+                buf += ".";
+                SendWhisper(buf, *inviter);
+            }
 
-            guild->BroadcastEvent(GE_JOINED, m_bot->GetObjectGuid(), m_bot->GetName());
+            std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_GROUP_INVITE_RESPONSE, 1));
+            packet->WriteBit(false);
+            packet->WriteBit(accept);
+            packet->FlushBits();
+            m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
+            return;
         }
 
         // Handle when another player opens the trade window with the bot
         // also sends list of tradable items bot can trade if bot is allowed to obey commands from
-    case SMSG_TRADE_STATUS:
+    case BOT_EVENT_TRADE_STATUS:
         {
-            if (m_bot->GetTrader() == nullptr)
-                break;
-
-            WorldPacket p(packet);
-            uint32 status;
-            p >> status;
-            p.resize(4);
-
-            //4 == TRADE_STATUS_TRADE_ACCEPT
-            if (status == 4)
+            if (event.value == TRADE_STATUS_TRADE_COMPLETE)
             {
-                m_bot->GetSession()->HandleAcceptTradeOpcode(p);  // packet not used
                 SetQuestNeedItems();
                 AutoUpgradeEquipment();
+                return;
             }
 
-            //1 == TRADE_STATUS_BEGIN_TRADE
-            else if (status == 1)
+            if (m_bot->GetTrader() == nullptr)
+                return;
+
+            if (event.value == TRADE_STATUS_TRADE_ACCEPT)
             {
-                m_bot->GetSession()->HandleBeginTradeOpcode(p); // packet not used
+                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_ACCEPT_TRADE, 4));
+                *packet << uint32(0);
+                m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
+            }
+            else if (event.value == TRADE_STATUS_BEGIN_TRADE)
+            {
+                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_BEGIN_TRADE, 0));
+                m_bot->GetSession()->QueuePacket(std::move(packet)); // queue the packet to get around race condition
 
                 if (!canObeyCommandFrom(*(m_bot->GetTrader())))
                 {
@@ -2273,144 +2413,46 @@ void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
             return;
         }
 
-    case SMSG_SPELL_START:
-        {
-            WorldPacket p(packet);
-
-            ObjectGuid castItemGuid;
-            p >> castItemGuid.ReadAsPacked();
-            ObjectGuid casterGuid;
-            p >> casterGuid.ReadAsPacked();
-            if (casterGuid != m_bot->GetObjectGuid())
-                return;
-
-            uint8 castCount;
-            p >> castCount;
-            uint32 spellId;
-            p >> spellId;
-            uint32 castFlags;
-            p >> castFlags;
-            uint32 msTime;
-            p >> msTime;
-
-            const SpellEntry* const pSpellInfo = sSpellTemplate.LookupEntry<SpellEntry>(spellId);
-            if (!pSpellInfo)
-                return;
-
-            if (pSpellInfo->AuraInterruptFlags & AURA_INTERRUPT_FLAG_NOT_SEATED)
-                return;
-
-            SetIgnoreUpdateTime((msTime / 1000) + 1);
-
-            return;
-        }
-
-    case SMSG_SPELL_GO:
-        {
-            WorldPacket p(packet);
-
-            ObjectGuid castItemGuid;
-            p >> castItemGuid.ReadAsPacked();
-            ObjectGuid casterGuid;
-            p >> casterGuid.ReadAsPacked();
-            if (casterGuid != m_bot->GetObjectGuid())
-                return;
-
-            uint8 castCount;
-            p >> castCount;
-            uint32 spellId;
-            p >> spellId;
-            uint32 castFlags;
-            p >> castFlags;
-            uint32 msTime;
-            p >> msTime;
-
-            return;
-        }
-
-        // if someone tries to resurrect, then accept
-    case SMSG_RESURRECT_REQUEST:
-        {
-            if (!m_bot->IsAlive())
-            {
-                WorldPacket p(packet);
-                ObjectGuid guid;
-                p >> guid;
-
-                std::unique_ptr<WorldPacket> packet(new WorldPacket(CMSG_RESURRECT_RESPONSE, 8 + 1));
-                *packet << guid;
-                *packet << uint8(1);                        // accept
-                m_bot->GetSession()->QueuePacket(std::move(packet));   // queue the packet to get around race condition
-
-                // set back to normal
-                SetState(BOTSTATE_NORMAL);
-                SetIgnoreUpdateTime(0);
-            }
-            return;
-        }
-
-    case SMSG_LOOT_RESPONSE:
+    case BOT_EVENT_LOOT_RESPONSE:
         {
-            WorldPacket p(packet); // (8+1+4+1+1+4+4+4+4+4+1)
-            ObjectGuid guid;
-            uint8 loot_type;
-            uint32 gold;
-            uint8 items;
+            Loot* loot = event.loot;
 
-            p >> guid;      // 8 corpse guid
-            p >> loot_type; // 1 loot type
-            p >> gold;      // 4 gold
-            p >> items;     // 1 items count
-
-            if (gold > 0)
+            if (loot->GetGoldAmount() > 0)
             {
                 WorldPacket* const packet = new WorldPacket(CMSG_LOOT_MONEY, 0);
                 m_bot->GetSession()->QueuePacket(std::move(std::unique_ptr<WorldPacket>(packet)));
             }
 
-            for (uint8 i = 0; i < items; ++i)
+            LootItemList lootItems;
+            loot->GetLootItemsListFor(m_bot, lootItems);
+            for (LootItemList::const_iterator itr = lootItems.begin(); itr != lootItems.end(); ++itr)
             {
-            uint32 itemid;
-                uint32 itemcount;
-                uint8 lootslot_type;
-                uint8 itemindex;
-
-                p >> itemindex;         // 1 counter
-                p >> itemid;            // 4 itemid
-                p >> itemcount;         // 4 item stack count
-                p.read_skip<uint32>();  // 4 item model
-                p.read_skip<uint32>();  // 4 randomSuffix
-                p.read_skip<uint32>();  // 4 randomPropertyId
-                p >> lootslot_type;     // 1 LootSlotType
-
-                if (lootslot_type != LOOT_SLOT_NORMAL)
+                LootItem* lootItem = *itr;
+                if (lootItem->lootItemType == LOOTITEM_TYPE_CURRENCY || lootItem->GetSlotTypeForSharedLoot(m_bot, loot) != LOOT_SLOT_NORMAL)
                     continue;
 
                 // skinning or collect loot flag = just auto loot everything for getting object
                 // corpse = run checks
-                if (loot_type == LOOT_SKINNING || HasCollectFlag(COLLECT_FLAG_LOOT) ||
-                    (loot_type == LOOT_CORPSE && (IsInQuestItemList(itemid) || IsItemUseful(itemid))))
+                if (loot->GetLootType() == LOOT_SKINNING || HasCollectFlag(COLLECT_FLAG_LOOT) ||
+                    (loot->GetLootType() == LOOT_CORPSE && (IsInQuestItemList(lootItem->itemId) || IsItemUseful(lootItem->itemId))))
                 {
                     WorldPacket* const packet = new WorldPacket(CMSG_AUTOSTORE_LOOT_ITEM, 1);
-                    *packet << itemindex;
+                    *packet << uint8(lootItem->lootSlot);
                     m_bot->GetSession()->QueuePacket(std::move(std::unique_ptr<WorldPacket>(packet)));
                 }
             }
 
             // release loot
             WorldPacket* const packet = new WorldPacket(CMSG_LOOT_RELEASE, 8);
-            *packet << guid;
+            *packet << event.guid;
             m_bot->GetSession()->QueuePacket(std::move(std::unique_ptr<WorldPacket>(packet)));
 
             return;
         }
 
-    case SMSG_LOOT_RELEASE_RESPONSE:
+    case BOT_EVENT_LOOT_RELEASED:
         {
-            WorldPacket p(packet);
-            ObjectGuid guid;
-
-            p >> guid;
+            ObjectGuid const& guid = event.guid;
 
             if (guid == m_lootCurrent)
             {
@@ -2455,20 +2497,10 @@ void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
             return;
         }
 
-    case SMSG_LOOT_ROLL_WON:
+    case BOT_EVENT_LOOT_ROLL_WON:
         {
-            WorldPacket p(packet);   // (8+4+4+4+4+8+1+1)
-            ObjectGuid p_guid, co_guid;
-            uint32 itemid;
-
-            p >> co_guid;            // creature or gameobject guid what we're looting
-            p.read_skip<uint32>();   // item slot in loot
-            p >> itemid;             // the itemEntryId for the item that shall be rolled fo
-            p.read_skip<uint32>();   // randomSuffix
-            p.read_skip<uint32>();   // Item random property
-            p >> p_guid;             // guid of the player who won
-            p.read_skip<uint8>();    // rollnumber related to SMSG_LOOT_ROLL
-            p.read_skip<uint8>();    // Rolltype related to SMSG_LOOT_ROLL
+            ObjectGuid const& co_guid = event.guid;
+            ObjectGuid const& p_guid = event.targetGuid;
 
             Loot* loot = sLootMgr.GetLoot(m_bot, co_guid);
 
@@ -2505,95 +2537,10 @@ void PlayerbotAI::HandleBotOutgoingPacket(const WorldPacket& packet)
             }*/
             return;
         }
-
-    case SMSG_PARTYKILLLOG:
-        {
-            // reset AI delay so bots immediately respond to next combat target & or looting/skinning
-            SetIgnoreUpdateTime(0);
-            return;
-        }
-
-    case SMSG_ITEM_PUSH_RESULT:
-        {
-            WorldPacket p(packet);  // (8+4+4+4+1+4+4+4+4+4+4)
-            ObjectGuid guid;
-
-            p >> guid;              // 8 player guid
-            if (m_bot->GetObjectGuid() != guid)
-                return;
-
-            uint8 bagslot;
-            uint32 itemslot, itemid, count, totalcount, received, created;
-
-            p >> received;          // 4 0=looted, 1=from npc
-            p >> created;           // 4 0=received, 1=created
-            p.read_skip<uint32>();  // 4 IsShowChatMessage
-            p >> bagslot;           // 1 bagslot
-            p >> itemslot;          // 4 item slot, but when added to stack: 0xFFFFFFFF
-            p >> itemid;            // 4 item entry id
-            p.read_skip<uint32>();  // 4 SuffixFactor
-            p.read_skip<uint32>();  // 4 random item property id
-            p >> count;             // 4 count of items
-            p >> totalcount;        // 4 count of items in inventory
-
-            ItemPrototype const *pProto = ObjectMgr::GetItemPrototype(itemid);
-            if (pProto)
-            {
-                std::ostringstream out;
-                if (received == 1)
-                {
-                    if (created == 1)
-                        out << "|cff009900" << "I created: |r";
-                    else
-                        out << "|cff009900" << "I received: |r";
-                    MakeItemLink(pProto, out);
-                    TellMaster(out.str().c_str());
-                    SetState(BOTSTATE_DELAYED);
-                }
-            }
-
-            if (IsInQuestItemList(itemid))
-            {
-                m_needItemList[itemid] = (m_needItemList[itemid] - count);
-                if (m_needItemList[itemid] <= 0)
-                    m_needItemList.erase(itemid);
-            }
-
-            return;
-        }
-
-        /* uncomment this and your bots will tell you all their outgoing packet opcode names
-        case SMSG_MONSTER_MOVE:
-        case SMSG_UPDATE_WORLD_STATE:
-        case SMSG_COMPRESSED_UPDATE_OBJECT:
-        case MSG_MOVE_SET_FACING:
-        case MSG_MOVE_STOP:
-        case MSG_MOVE_HEARTBEAT:
-        case MSG_MOVE_STOP_STRAFE:
-        case MSG_MOVE_START_STRAFE_LEFT:
-        case SMSG_UPDATE_OBJECT:
-        case MSG_MOVE_START_FORWARD:
-        case MSG_MOVE_START_STRAFE_RIGHT:
-        case SMSG_DESTROY_OBJECT:
-        case MSG_MOVE_START_BACKWARD:
-        case SMSG_AURA_UPDATE_ALL:
-        case MSG_MOVE_FALL_LAND:
-        case MSG_MOVE_JUMP:
-        return;*/
-
-    default:
-        {
-            /*const char* oc = LookupOpcodeName(packet.GetOpcode());
-
-            std::ostringstream out;
-            out << "botout: " << oc;
-            sLog.outError(out.str().c_str());
-
-            TellMaster(oc);*/
-        }
     }
 }
 
+
 uint8 PlayerbotAI::GetHealthPercent(const Unit& target) const
 {
     return (static_cast<float> (target.GetHealth()) / target.GetMaxHealth()) * 100;
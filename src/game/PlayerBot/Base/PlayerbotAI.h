@@ -32,6 +32,7 @@ class Player;
 class Unit;
 class Object;
 class Item;
+class Loot;
 class PlayerbotClassAI;
 class PlayerbotMgr;
 
@@ -1560,6 +1561,38 @@ enum m_FollowAutoGo
     FOLLOWAUTOGO_RUN        = 4
 };
 
+// Events delivered directly to the bot AI instead of being serialized into a packet
+// and parsed back by HandleBotOutgoingPacket
+enum PlayerbotEventType
+{
+    BOT_EVENT_DUEL_REQUESTED,           // guid: challenger, targetGuid: duel flag
+    BOT_EVENT_DUEL_OUT_OF_BOUNDS,
+    BOT_EVENT_DUEL_COMPLETE,
+    BOT_EVENT_DUEL_WINNER,              // raised from SMSG_DUEL_WINNER, which reaches every bot around the duel
+    BOT_EVENT_GROUP_INVITE,
+    BOT_EVENT_GROUP_SET_LEADER,         // guid: new leader
+    BOT_EVENT_PARTY_RESULT,             // value: PartyOperation, value2: PartyResult, text: member name
+    BOT_EVENT_TRADE_STATUS,             // value: TradeStatus
+    BOT_EVENT_LOOT_RESPONSE,            // guid: loot source, loot: content shown to the bot
+    BOT_EVENT_LOOT_RELEASED,            // guid: loot source
+    BOT_EVENT_LOOT_ROLL_WON,            // guid: loot source, targetGuid: winner, value: item entry
+    BOT_EVENT_CHAT                      // guid: sender, value: ChatMsg, value2: Language, text: message
+};
+
+struct PlayerbotEvent
+{
+    explicit PlayerbotEvent(PlayerbotEventType _type, ObjectGuid _guid = ObjectGuid(), uint32 _value = 0)
+        : type(_type), guid(_guid), value(_value), value2(0), loot(nullptr) {}
+
+    PlayerbotEventType type;
+    ObjectGuid guid;
+    ObjectGuid targetGuid;
+    uint32 value;
+    uint32 value2;
+    std::string text;
+    Loot* loot;
+};
+
 class PlayerbotAI
 {
 public:
@@ -1733,6 +1766,10 @@ public:
     // For a list of opcodes that can be caught see Opcodes.cpp (SMSG_* opcodes only)
     void HandleBotOutgoingPacket(const WorldPacket& packet);
 
+    // This is called directly by the game code for the events bots react to
+    // (duel, group, trade, loot and chat), the matching packets are never built for a bot
+    void HandleBotEvent(const PlayerbotEvent& event);
+
     // This is called by WorldSession.cpp
     // when it detects that a bot is being teleported. It acknowledges to the server to complete the
     // teleportation
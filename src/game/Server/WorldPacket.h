@@ -23,6 +23,7 @@
 #include "Util/ByteBuffer.h"
 #include "Server/Opcodes.h"
 #include <chrono>
+#include <memory>
 
 // Note: m_opcode and size stored in platfom dependent format
 // ignore endianess until send, and converted at receive
@@ -61,4 +62,7 @@ class WorldPacket : public ByteBuffer
         Opcodes m_opcode;
         std::chrono::steady_clock::time_point m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
+
+// immutable packet shared by all receivers of a broadcast, sockets queue it without copying
+typedef std::shared_ptr<WorldPacket const> WorldPacketShared;
 #endif
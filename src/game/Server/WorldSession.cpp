@@ -131,6 +131,18 @@ char const* WorldSession::GetPlayerName() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const& packet) const
+{
+    if (CanSendPacket(packet))
+        m_Socket->SendPacket(packet);
+}
+
+void WorldSession::SendPacket(WorldPacketShared const& packet) const
+{
+    if (CanSendPacket(*packet))
+        m_Socket->SendPacket(packet);
+}
+
+bool WorldSession::CanSendPacket(WorldPacket const& packet) const
 {
 #ifdef BUILD_DEPRECATED_PLAYERBOT
     // Send packet to bot AI
@@ -144,7 +156,7 @@ void WorldSession::SendPacket(WorldPacket const& packet) const
 #endif
 
     if (!m_Socket || m_Socket->IsClosed())
-        return;
+        return false;
 
 #ifdef MANGOS_DEBUG
 
@@ -182,7 +194,7 @@ void WorldSession::SendPacket(WorldPacket const& packet) const
 
 #endif                                                  // !MANGOS_DEBUG
 
-    m_Socket->SendPacket(packet);
+    return true;
 }
 
 /// Add an incoming packet to the queue
@@ -490,6 +502,7 @@ void WorldSession::LogoutPlayer(bool Save)
                 slot->UpdateLogoutTime();
             }
 
+            guild->MemberLoggedOut(_player);
             guild->BroadcastEvent(GE_SIGNED_OFF, _player->GetObjectGuid(), _player->GetName());
         }
 
@@ -249,6 +249,8 @@ class WorldSession
         void SendAddonsInfo();
 
         void SendPacket(WorldPacket const& packet) const;
+        // packet shared by several receivers, see WorldPacketShared
+        void SendPacket(std::shared_ptr<WorldPacket const> const& packet) const;
         void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(int32 string_id, ...);
         void SendPetNameInvalid(uint32 error, const std::string& name, DeclinedName* declinedName);
@@ -274,6 +276,8 @@ class WorldSession
 #else
         const std::string GetRemoteAddress() const { return m_Socket->GetRemoteAddress(); }
 #endif
+        /// Sessions without socket belong to bots, object updates built for them would never be read
+        bool IsBotSession() const { return !m_Socket; }
         void SetPlayer(Player* plr);
         uint8 Expansion() const { return m_expansion; }
 
@@ -306,8 +310,7 @@ class WorldSession
         void SendAuthWaitQue(uint32 position);
 
         void SendNameQueryOpcode(Player* p);
-        void SendNameQueryOpcodeFromDB(ObjectGuid guid);
-        static void SendNameQueryOpcodeFromDBCallBack(QueryResult* result, uint32 accountId);
+        void SendNameQueryOpcodeFromCache(ObjectGuid guid);
 
         void SendTrainerList(ObjectGuid guid);
         void SendTrainerList(ObjectGuid guid, const std::string& strTitle);
@@ -899,6 +902,9 @@ class WorldSession
 
         void ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket & packet);
 
+        // bot forwarding and checks common to both SendPacket() versions
+        bool CanSendPacket(WorldPacket const& packet) const;
+
         // logging helper
         void LogUnexpectedOpcode(WorldPacket const& packet, const char* reason);
         void LogUnprocessedTail(WorldPacket packet);
@@ -35,8 +35,12 @@
 #include "LuaEngine/LuaEngine.h"
 #endif
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <boost/asio.hpp>
 
@@ -85,28 +89,153 @@ struct ServerPktHeader
 #pragma pack(pop)
 #endif
 
+// Packets the client should see without waiting for the socket buffer timeout (movement, combat, spell casts)
+static bool IsLatencySensitiveOpcode(uint16 opcode)
+{
+    switch (opcode)
+    {
+        case SMSG_MONSTER_MOVE:
+        case SMSG_MONSTER_MOVE_TRANSPORT:
+        case SMSG_PLAYER_MOVE:
+        case SMSG_MOVE_TELEPORT:
+        case SMSG_SPELL_START:
+        case SMSG_SPELL_GO:
+        case SMSG_SPELL_FAILURE:
+        case SMSG_SPELL_COOLDOWN:
+        case SMSG_ATTACKSTART:
+        case SMSG_ATTACKSTOP:
+        case SMSG_ATTACKERSTATEUPDATE:
+        case SMSG_SPELLNONMELEEDAMAGELOG:
+        case SMSG_SPELLHEALLOG:
+        case SMSG_POWER_UPDATE:
+        case SMSG_PONG:
+        case SMSG_TIME_SYNC_REQ:
+            return true;
+        default:
+            return false;
+    }
+}
+
 WorldSocket::WorldSocket(boost::asio::io_context &context, std::function<void (Socket *)> closeHandler)
     : Socket(context, closeHandler), m_lastPingTime(std::chrono::system_clock::time_point::min()), m_overSpeedPings(0),
-      m_useExistingHeader(false), m_session(nullptr),m_seed(urand())
+      m_useExistingHeader(false), m_session(nullptr),m_seed(urand()), m_sendQueueSize(0), m_sendQueueImmediate(false), m_sendQueueScheduled(false)
 {
     InitializeOpcodes();
 }
 
+// Send queue slots with bigger buffers are freed after sending
+#define SEND_QUEUE_SLOT_KEPT_SIZE (16 * 1024)
+
+struct WorldSocket::QueuedPacket
+{
+    WorldPacket packet;                                     // copy of a single receiver packet
+    WorldPacketShared shared;                               // or a broadcast packet
+
+    WorldPacket const& Get() const { return shared ? *shared : packet; }
+};
+
+WorldSocket::~WorldSocket() = default;                      // QueuedPacket is incomplete in the header
+
+WorldSocket::QueuedPacket& WorldSocket::AddQueuedPacket()
+{
+    if (m_sendQueueSize == m_sendQueue.size())
+        m_sendQueue.emplace_back(new QueuedPacket());
+
+    return *m_sendQueue[m_sendQueueSize++];
+}
+
+void WorldSocket::ScheduleSendQueue(bool immediate)
+{
+    if (immediate)
+        m_sendQueueImmediate = true;
+
+    if (m_sendQueueScheduled)
+        return;
+
+    m_sendQueueScheduled = true;
+
+    std::shared_ptr<WorldSocket> ptr = shared<WorldSocket>();
+    boost::asio::post(GetAsioSocket().get_executor(), [ptr]() { ptr->SendQueuedPackets(); });
+}
+
 void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
 {
     if (IsClosed())
         return;
 
-    // Dump outgoing packet.
-    sLog.outWorldPacketDump(GetRemoteEndpoint().c_str(), pct.GetOpcode(), pct.GetOpcodeName(), pct, false);
-
-    ServerPktHeader header(pct.size() + 2, pct.GetOpcode());
-    m_crypt.EncryptSend((uint8*)header.header, header.getHeaderLength());
+    // the calling (world/map) thread only copies the payload into a queue slot, header,
+    // encryption and buffering are done by SendQueuedPackets() on the network thread of the socket
+    std::lock_guard<std::mutex> guard(m_sendQueueLock);
 
+    WorldPacket& packet = AddQueuedPacket().packet;
+    packet.Initialize(pct.GetOpcode(), pct.size());
     if (pct.size() > 0)
-        Write(reinterpret_cast<const char *>(&header.header), header.getHeaderLength(), reinterpret_cast<const char *>(pct.contents()), pct.size());
-    else
-        Write(reinterpret_cast<const char *>(&header.header), header.getHeaderLength());
+        packet.append(pct.contents(), pct.size());
+
+    ScheduleSendQueue(immediate);
+}
+
+void WorldSocket::SendPacket(WorldPacketShared const& pct, bool immediate)
+{
+    if (IsClosed())
+        return;
+
+    std::lock_guard<std::mutex> guard(m_sendQueueLock);
+
+    AddQueuedPacket().shared = pct;
+
+    ScheduleSendQueue(immediate);
+}
+
+void WorldSocket::SendQueuedPackets()
+{
+    size_t count;
+    bool immediate;
+
+    {
+        std::lock_guard<std::mutex> guard(m_sendQueueLock);
+        m_sendQueueSending.swap(m_sendQueue);
+        count = m_sendQueueSize;
+        m_sendQueueSize = 0;
+        immediate = m_sendQueueImmediate;
+        m_sendQueueImmediate = false;
+        m_sendQueueScheduled = false;
+    }
+
+    size_t i = 0;
+    for (; i < count && !IsClosed(); ++i)
+    {
+        QueuedPacket& queued = *m_sendQueueSending[i];
+        WorldPacket const& pct = queued.Get();
+
+        // Dump outgoing packet.
+        sLog.outWorldPacketDump(GetRemoteEndpoint().c_str(), pct.GetOpcode(), pct.GetOpcodeName(), pct, false);
+
+        ServerPktHeader header(pct.size() + 2, pct.GetOpcode());
+        m_crypt.EncryptSend((uint8*)header.header, header.getHeaderLength());
+
+        if (pct.size() > 0)
+            Write(reinterpret_cast<const char *>(&header.header), header.getHeaderLength(), reinterpret_cast<const char *>(pct.contents()), pct.size());
+        else
+            Write(reinterpret_cast<const char *>(&header.header), header.getHeaderLength());
+
+        if (!immediate && IsLatencySensitiveOpcode(pct.GetOpcode()))
+            immediate = true;
+
+        // broadcast packets are freed by their last receiver, the slot buffer stays for reuse
+        // unless a rare big packet grew it
+        queued.shared.reset();
+        if (queued.packet.size() > SEND_QUEUE_SLOT_KEPT_SIZE)
+            m_sendQueueSending[i].reset(new QueuedPacket());
+    }
+
+    // the socket was closed, e.g. by an out buffer overflow in Write(), drop the rest of the batch
+    if (i < count)
+    {
+        for (; i < count; ++i)
+            m_sendQueueSending[i]->shared.reset();
+        return;
+    }
 
     if (immediate)
         ForceFlushOut();
@@ -288,13 +417,10 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
 {
     // NOTE: ATM the socket is singlethread, have this in mind ...
     uint8 digest[20];
-    uint16 clientBuild, security;
-    uint32 id, m_addonSize, clientSeed, expansion;
+    uint16 clientBuild;
+    uint32 m_addonSize, clientSeed;
     std::string accountName;
-    LocaleConstant locale;
 
-    Sha1Hash sha1;
-    BigNumber v, s, g, N, K;
     WorldPacket packet;
 
     recvPacket.read_skip<uint32>();
@@ -360,29 +486,45 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
         return false;
     }
 
-    // Get the account information from the realmd database
-    std::string safe_account = accountName; // Duplicate, else will screw the SHA hash verification below
-    LoginDatabase.escape_string (safe_account);
-    // No SQL injection, username escaped.
+    std::lock_guard<std::mutex> guard(s_authQueueLock);
+
+    // server is shutting down
+    if (!s_authWorkers)
+        return false;
+
+    AuthSessionRequest request;
+    request.socket = shared<WorldSocket>();
+    request.accountName = accountName;
+    memcpy(request.digest, digest, sizeof(digest));
+    request.clientSeed = clientSeed;
+    request.addonsData = std::move(addonsData);
+
+    // Account lookup and session setup run on the auth workers, packets of this socket wait for the result
+    SuspendProcessing();
+
+    s_authQueue.push_back(std::move(request));
+
+    // a batch that is not started yet takes this request as well
+    if (!s_authQueueScheduled)
+    {
+        s_authQueueScheduled = true;
+        boost::asio::post(s_authWorkers->GetContext(), &WorldSocket::ProcessAuthSessionQueue);
+    }
 
-    QueryResult* result =
-        LoginDatabase.PQuery("SELECT "
-                             "id, "                      //0
-                             "gmlevel, "                 //1
-                             "sessionkey, "              //2
-                             "lockedIp, "                //3
-                             "locked, "                  //4
-                             "v, "                       //5
-                             "s, "                       //6
-                             "expansion, "               //7
-                             "mutetime, "                //8
-                             "locale "                   //9
-                             "FROM account "
-                             "WHERE username = '%s'",
-                             safe_account.c_str());
+    return true;
+}
+
+bool WorldSocket::FinishAuthSession(AuthSessionRequest& request, AuthAccountInfo const* account, bool banned)
+{
+    uint16 security;
+    uint32 id, expansion;
+    LocaleConstant locale;
+
+    BigNumber v, s, g, N, K;
+    WorldPacket packet;
 
     // Stop if the account is not found
-    if (!result)
+    if (!account)
     {
         packet.Initialize (SMSG_AUTH_RESPONSE, 2);
         packet.WriteBit(false);
@@ -395,15 +537,13 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
         return false;
     }
 
-    Field* fields = result->Fetch ();
-
-    expansion = ((sWorld.getConfig(CONFIG_UINT32_EXPANSION) > fields[7].GetUInt8()) ? fields[7].GetUInt8() : sWorld.getConfig(CONFIG_UINT32_EXPANSION));
+    expansion = ((sWorld.getConfig(CONFIG_UINT32_EXPANSION) > account->expansion) ? account->expansion : sWorld.getConfig(CONFIG_UINT32_EXPANSION));
 
     N.SetHexStr("894B645E89E1535BBDAD5B8B290650530801B18EBFBF5E8FAB3C82872A3E9BB7");
     g.SetDword(7);
 
-    v.SetHexStr(fields[5].GetString());
-    s.SetHexStr(fields[6].GetString());
+    v.SetHexStr(account->v.c_str());
+    s.SetHexStr(account->s.c_str());
     m_s = s;
 
     const char* sStr = s.AsHexStr ();                       //Must be freed by OPENSSL_free()
@@ -417,9 +557,9 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
     OPENSSL_free ((void*) vStr);
 
     ///- Re-check ip locking (same check as in realmd).
-    if (fields[4].GetUInt8 () == 1) // if ip is locked
+    if (account->locked == 1) // if ip is locked
     {
-        if (strcmp (fields[3].GetString(), GetRemoteAddress().c_str()))
+        if (account->lockedIp != GetRemoteAddress())
         {
             packet.Initialize (SMSG_AUTH_RESPONSE, 2);
             packet.WriteBit(false);
@@ -427,37 +567,28 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
             packet << uint8 (AUTH_FAILED);
             SendPacket (packet);
 
-            delete result;
             BASIC_LOG("WorldSocket::HandleAuthSession: Sent Auth Response (Account IP differs).");
             return false;
         }
     }
 
-    id = fields[0].GetUInt32();
-    security = fields[1].GetUInt16();
+    id = account->id;
+    security = account->security;
     if(security > SEC_ADMINISTRATOR)                        // prevent invalid security settings in DB
         security = SEC_ADMINISTRATOR;
 
-    K.SetHexStr (fields[2].GetString());
+    K.SetHexStr (account->sessionKey.c_str());
 
-    time_t mutetime = time_t (fields[8].GetUInt64());
+    time_t mutetime = time_t (account->mutetime);
 
-    uint8 tempLoc = LocaleConstant(fields[9].GetUInt8());
+    uint8 tempLoc = LocaleConstant(account->locale);
     if (tempLoc >= static_cast<uint8>(MAX_LOCALE))
         locale = LOCALE_enUS;
     else
         locale = LocaleConstant(tempLoc);
 
-    delete result;
-
     // Re-check account ban (same check as in realmd)
-    QueryResult *banresult =
-          LoginDatabase.PQuery ("SELECT 1 FROM account_banned WHERE account_id = %u AND active = 1 AND (expires_at > UNIX_TIMESTAMP() OR expires_at = banned_at)"
-                                "UNION "
-                                "SELECT 1 FROM ip_banned WHERE (expires_at = banned_at OR expires_at > UNIX_TIMESTAMP()) AND ip = '%s'",
-                                id, GetRemoteAddress().c_str());
-
-    if (banresult) // if account banned
+    if (banned) // if account banned
     {
         packet.Initialize (SMSG_AUTH_RESPONSE, 2);
         packet.WriteBit(false);
@@ -465,8 +596,6 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
         packet << uint8 (AUTH_BANNED);
         SendPacket (packet);
 
-        delete banresult;
-
         sLog.outError("WorldSocket::HandleAuthSession: Sent Auth Response (Account banned).");
         return false;
     }
@@ -493,14 +622,14 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
     uint32 t = 0;
     uint32 seed = m_seed;
 
-    sha.UpdateData (accountName);
+    sha.UpdateData (request.accountName);
     sha.UpdateData ((uint8 *) & t, 4);
-    sha.UpdateData ((uint8 *) & clientSeed, 4);
+    sha.UpdateData ((uint8 *) & request.clientSeed, 4);
     sha.UpdateData ((uint8 *) & seed, 4);
     sha.UpdateBigNumbers (&K, nullptr);
     sha.Finalize ();
 
-    if (memcmp (sha.GetDigest (), digest, 20))
+    if (memcmp (sha.GetDigest (), request.digest, 20))
     {
         packet.Initialize (SMSG_AUTH_RESPONSE, 2);
         packet.WriteBit(false);
@@ -516,7 +645,7 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
     const std::string &address = GetRemoteAddress();
 
     DEBUG_LOG ("WorldSocket::HandleAuthSession: Client '%s' authenticated successfully from %s.",
-                accountName.c_str (),
+                request.accountName.c_str (),
                 address.c_str ());
 
     // Update the last_ip in the database
@@ -532,13 +661,185 @@ bool WorldSocket::HandleAuthSession(WorldPacket &recvPacket)
 
     m_session->LoadGlobalAccountData();
     m_session->LoadTutorialsData();
-    m_session->ReadAddonsInfo(addonsData);
+    m_session->ReadAddonsInfo(request.addonsData);
 
     sWorld.AddSession(m_session);
 
     return true;
 }
 
+// Auth sessions per account lookup query, keeps the statements reasonably small
+#define AUTH_SESSION_BATCH_SIZE 100
+
+std::unique_ptr<MaNGOS::WorkerPool> WorldSocket::s_authWorkers;
+std::mutex WorldSocket::s_authQueueLock;
+std::vector<WorldSocket::AuthSessionRequest> WorldSocket::s_authQueue;
+bool WorldSocket::s_authQueueScheduled = false;
+
+void WorldSocket::StartAuthWorkers(int threads)
+{
+    s_authWorkers.reset(new MaNGOS::WorkerPool(threads,
+        []() { LoginDatabase.ThreadStart(); },              // let thread do safe mySQL requests (one connection call enough)
+        []() { LoginDatabase.ThreadEnd(); }));              // free mySQL thread resources
+}
+
+void WorldSocket::StopAuthWorkers()
+{
+    std::unique_ptr<MaNGOS::WorkerPool> workers;
+    {
+        std::lock_guard<std::mutex> guard(s_authQueueLock);
+        workers.swap(s_authWorkers);
+    }
+
+    // finishes the queued batches, outside the lock as they take it themselves
+    workers.reset();
+}
+
+// the database compares account names case insensitive, match the rows of a batch the same way
+static std::string AuthAccountKey(std::string name)
+{
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::toupper(c); });
+    return name;
+}
+
+static bool IsAsciiName(std::string const& name)
+{
+    return std::all_of(name.begin(), name.end(), [](unsigned char c) { return c < 0x80; });
+}
+
+void WorldSocket::ProcessAuthSessionQueue()
+{
+    std::vector<AuthSessionRequest> requests;
+    {
+        std::lock_guard<std::mutex> guard(s_authQueueLock);
+        requests.swap(s_authQueue);
+        s_authQueueScheduled = false;
+    }
+
+    for (size_t begin = 0; begin < requests.size(); begin += AUTH_SESSION_BATCH_SIZE)
+    {
+        size_t const end = std::min(requests.size(), begin + AUTH_SESSION_BATCH_SIZE);
+
+        std::string names;
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::string safe_account = requests[i].accountName;
+            LoginDatabase.escape_string(safe_account);
+
+            if (!names.empty())
+                names += ",";
+            names += "'" + safe_account + "'";
+        }
+
+        // Get the account information of the whole batch from the realmd database
+        // No SQL injection, usernames escaped.
+        std::unordered_map<std::string, AuthAccountInfo> accounts;
+        std::string sql = "SELECT id, gmlevel, sessionkey, lockedIp, locked, v, s, expansion, mutetime, locale, username FROM account WHERE username IN (" + names + ")";
+        if (QueryResult* result = LoginDatabase.Query(sql.c_str()))
+        {
+            do
+            {
+                Field* fields = result->Fetch();
+
+                AuthAccountInfo& account = accounts[AuthAccountKey(fields[10].GetCppString())];
+                account.id = fields[0].GetUInt32();
+                account.security = fields[1].GetUInt16();
+                account.sessionKey = fields[2].GetCppString();
+                account.lockedIp = fields[3].GetCppString();
+                account.locked = fields[4].GetUInt8();
+                account.v = fields[5].GetCppString();
+                account.s = fields[6].GetCppString();
+                account.expansion = fields[7].GetUInt8();
+                account.mutetime = fields[8].GetUInt64();
+                account.locale = fields[9].GetUInt8();
+            }
+            while (result->NextRow());
+
+            delete result;
+        }
+
+        // Re-check account and ip bans (same check as in realmd)
+        std::string accountIds, addresses;
+        for (auto const& account : accounts)
+        {
+            if (!accountIds.empty())
+                accountIds += ",";
+            accountIds += std::to_string(account.second.id);
+        }
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!addresses.empty())
+                addresses += ",";
+            addresses += "'" + requests[i].socket->GetRemoteAddress() + "'";
+        }
+
+        std::unordered_set<uint32> bannedAccounts;
+        if (!accountIds.empty())
+        {
+            if (QueryResult* result = LoginDatabase.PQuery("SELECT account_id FROM account_banned WHERE account_id IN (%s) AND active = 1 AND (expires_at > UNIX_TIMESTAMP() OR expires_at = banned_at)", accountIds.c_str()))
+            {
+                do
+                    bannedAccounts.insert(result->Fetch()[0].GetUInt32());
+                while (result->NextRow());
+
+                delete result;
+            }
+        }
+
+        // No SQL injection, addresses as received by socket
+        std::unordered_set<std::string> bannedAddresses;
+        sql = "SELECT ip FROM ip_banned WHERE (expires_at = banned_at OR expires_at > UNIX_TIMESTAMP()) AND ip IN (" + addresses + ")";
+        if (QueryResult* result = LoginDatabase.Query(sql.c_str()))
+        {
+            do
+                bannedAddresses.insert(result->Fetch()[0].GetCppString());
+            while (result->NextRow());
+
+            delete result;
+        }
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            AuthSessionRequest& request = requests[i];
+            std::shared_ptr<WorldSocket> socket = request.socket;
+
+            // client is gone already
+            if (socket->IsClosed())
+            {
+                socket->ResumeProcessing(false);
+                continue;
+            }
+
+            AuthAccountInfo const* account = nullptr;
+            auto found = accounts.find(AuthAccountKey(request.accountName));
+            if (found != accounts.end())
+                account = &found->second;
+            // non latin names may be matched by the database in a way the upper case key does not cover
+            else if (!IsAsciiName(request.accountName))
+            {
+                std::string safe_account = request.accountName;
+                LoginDatabase.escape_string(safe_account);
+
+                if (QueryResult* result = LoginDatabase.PQuery("SELECT id FROM account WHERE username = '%s'", safe_account.c_str()))
+                {
+                    uint32 accountId = result->Fetch()[0].GetUInt32();
+                    delete result;
+
+                    for (auto const& itr : accounts)
+                        if (itr.second.id == accountId)
+                            account = &itr.second;
+                }
+            }
+
+            bool banned = account && (bannedAccounts.find(account->id) != bannedAccounts.end() ||
+                                      bannedAddresses.find(socket->GetRemoteAddress()) != bannedAddresses.end());
+
+            socket->ResumeProcessing(socket->FinishAuthSession(request, account, banned));
+        }
+    }
+}
+
 bool WorldSocket::HandlePing(WorldPacket &recvPacket)
 {
     uint32 ping;
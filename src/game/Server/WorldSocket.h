@@ -28,10 +28,16 @@
 #include "Common.h"
 #include "Server/AuthCrypt.h"
 #include "Auth/BigNumber.h"
+#include "Util/ByteBuffer.h"
 #include "Network/Socket.hpp"
+#include "Network/WorkerPool.hpp"
 
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 class WorldPacket;
 class WorldSession;
@@ -111,23 +117,76 @@ class WorldSocket : public MaNGOS::Socket
 
         BigNumber m_s;
 
+        /// Packets sent by other threads, waiting for the network thread to encrypt and buffer them.
+        /// The slots are swapped between both vectors and keep their buffers, so queueing a packet
+        /// is one copy into an already allocated buffer.
+        struct QueuedPacket;
+        typedef std::vector<std::unique_ptr<QueuedPacket>> SendQueue;
+
+        std::mutex m_sendQueueLock;
+        SendQueue m_sendQueue;
+        size_t m_sendQueueSize;
+        SendQueue m_sendQueueSending;                       ///< only used by the network thread
+        bool m_sendQueueImmediate;
+        bool m_sendQueueScheduled;
+
+        /// Next free queue slot, m_sendQueueLock must be held
+        QueuedPacket& AddQueuedPacket();
+        /// Schedule SendQueuedPackets(), m_sendQueueLock must be held
+        void ScheduleSendQueue(bool immediate);
+
+        /// Runs on the network thread, writes all queued packets to the socket
+        void SendQueuedPackets();
+
         /// process one incoming packet.
         virtual bool ProcessIncomingData() override;
 		
 		/// Called on open ,the void* is the acceptor.
         bool HandleWowConnection(WorldPacket& recvPacket);
 
-        /// Called by ProcessIncoming() on CMSG_AUTH_SESSION.
+        /// CMSG_AUTH_SESSION content still needed after the account lookup
+        struct AuthSessionRequest
+        {
+            std::shared_ptr<WorldSocket> socket;
+            std::string accountName;
+            uint8 digest[20];
+            uint32 clientSeed;
+            ByteBuffer addonsData;
+        };
+
+        /// Account row of a CMSG_AUTH_SESSION
+        struct AuthAccountInfo
+        {
+            uint32 id;
+            uint16 security;
+            std::string sessionKey;
+            std::string lockedIp;
+            uint8 locked;
+            std::string v;
+            std::string s;
+            uint8 expansion;
+            uint64 mutetime;
+            uint8 locale;
+        };
+
+        /// Called by ProcessIncoming() on CMSG_AUTH_SESSION, queues the account lookup for the auth workers.
         bool HandleAuthSession(WorldPacket &recvPacket);
+        /// Called by the auth workers with the looked up account, account is nullptr for unknown accounts.
+        bool FinishAuthSession(AuthSessionRequest& request, AuthAccountInfo const* account, bool banned);
+        /// Looks up the accounts of all queued auth sessions with one query per batch.
+        static void ProcessAuthSessionQueue();
 
         /// Called by ProcessIncoming() on CMSG_PING.
         bool HandlePing(WorldPacket &recvPacket);
 
     public:
         WorldSocket(boost::asio::io_context& context, std::function<void (Socket *)> closeHandler);
+        ~WorldSocket();
 
         // send a packet \o/
         void SendPacket(const WorldPacket& pct, bool immediate = false);
+        // send a packet shared with other receivers, queued without a copy
+        void SendPacket(std::shared_ptr<WorldPacket const> const& pct, bool immediate = false);
 
         void FinalizeSession() { m_session = nullptr; }
 
@@ -136,6 +195,16 @@ class WorldSocket : public MaNGOS::Socket
         /// Return the session key
         BigNumber &GetSessionKey() { return m_s; }
 
+        /// Workers doing the database work of CMSG_AUTH_SESSION, off the network threads
+        static void StartAuthWorkers(int threads);
+        static void StopAuthWorkers();
+
+    private:
+        static std::unique_ptr<MaNGOS::WorkerPool> s_authWorkers;
+        static std::mutex s_authQueueLock;
+        static std::vector<AuthSessionRequest> s_authQueue;
+        static bool s_authQueueScheduled;
+
 };
 
 #endif  /* _WORLDSOCKET_H */
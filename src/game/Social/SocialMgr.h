@@ -22,6 +22,9 @@
 #include "Database/DatabaseEnv.h"
 #include "Entities/ObjectGuid.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 class SocialMgr;
 class PlayerSocial;
 class Player;
@@ -137,7 +140,7 @@ class SocialMgr
         SocialMgr();
         ~SocialMgr();
         // Misc
-        void RemovePlayerSocial(uint32 guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(uint32 guid);
 
         void GetFriendInfo(Player* player, uint32 friendGUID, FriendInfo& friendInfo);
         // Packet management
@@ -147,7 +150,16 @@ class SocialMgr
         // Loading
         PlayerSocial* LoadFromDB(QueryResult* result, ObjectGuid guid);
     private:
+        friend class PlayerSocial;
+
+        // reverse friend index, updated whenever a loaded social list gains or loses a friend
+        void AddFriendLister(uint32 friendGuid, uint32 listerGuid);
+        void RemoveFriendLister(uint32 friendGuid, uint32 listerGuid);
+
+        typedef std::unordered_map<uint32 /*friend*/, std::unordered_set<uint32> /*players with him as friend*/> FriendListersMap;
+
         SocialMap m_socialMap;
+        FriendListersMap m_friendListers;
 };
 
 #define sSocialMgr MaNGOS::Singleton<SocialMgr>::Instance()
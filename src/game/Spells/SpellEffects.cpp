@@ -57,6 +57,9 @@
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
 #endif
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+#include "PlayerBot/Base/PlayerbotAI.h"
+#endif
 
 pEffect SpellEffects[TOTAL_SPELL_EFFECTS] =
 {
@@ -10599,6 +10602,15 @@ void Spell::EffectDuel(SpellEffectIndex eff_idx)
     caster->GetSession()->SendPacket(data);
     target->GetSession()->SendPacket(data);
 
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    PlayerbotEvent duelEvent(BOT_EVENT_DUEL_REQUESTED, caster->GetObjectGuid());
+    duelEvent.targetGuid = pGameObj->GetObjectGuid();
+    if (PlayerbotAI* ai = caster->GetPlayerbotAI())
+        ai->HandleBotEvent(duelEvent);
+    if (PlayerbotAI* ai = target->GetPlayerbotAI())
+        ai->HandleBotEvent(duelEvent);
+#endif
+
     // create duel-info
     DuelInfo* duel   = new DuelInfo;
     duel->initiator  = caster;
@@ -27,6 +27,8 @@
 #include "Entities/Unit.h"
 #include "Maps/Map.h"
 
+std::vector<uint32> sSpellDerivedFlags;
+
 bool IsPrimaryProfessionSkill(uint32 skill)
 {
     SkillLineEntry const* pSkill = sSkillLineStore.LookupEntry(skill);
@@ -1701,6 +1703,121 @@ bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellProcEventEntry const* spellPr
     return false;
 }
 
+// Can the IsPositiveEffectTargetMode result differ for different caster/target pairs
+static bool IsEffectTargetModeContextDependent(SpellEntry const* entry, SpellEffectIndex effIndex, bool recursive = false)
+{
+    if (IsSpellEffectTriggerSpell(entry, effIndex))
+    {
+        uint32 spellid = entry->EffectTriggerSpell[effIndex];
+        if (!recursive && spellid && spellid != entry->Id)
+        {
+            if (SpellEntry const* triggered = sSpellTemplate.LookupEntry<SpellEntry>(spellid))
+            {
+                for (uint32 i = EFFECT_INDEX_0; i < MAX_EFFECT_INDEX; ++i)
+                    if (IsEffectTargetModeContextDependent(triggered, SpellEffectIndex(i), true))
+                        return true;
+            }
+        }
+        return false;
+    }
+
+    uint32 a = entry->EffectImplicitTargetA[effIndex];
+    uint32 b = entry->EffectImplicitTargetB[effIndex];
+
+    if ((!a && !b) || IsEffectTargetPositive(a, b) || IsEffectTargetScript(a, b) || IsEffectTargetNegative(a, b))
+        return false;
+
+    if (IsEffectTargetNeutral(a, b))
+        return !IsPointEffectTarget(SpellTarget(b ? b : a)) && IsNeutralEffectTargetUnitDependent(b ? b : a);
+
+    return false;
+}
+
+void SpellMgr::LoadSpellDerivedFlags()
+{
+    sSpellDerivedFlags.assign(sSpellTemplate.GetMaxEntry(), 0);
+
+    uint32 count = 0;
+    uint32 contextCount = 0;
+
+    BarGoLink bar(sSpellTemplate.GetMaxEntry());
+
+    for (uint32 id = 1; id < sSpellTemplate.GetMaxEntry(); ++id)
+    {
+        bar.step();
+
+        SpellEntry const* spellInfo = sSpellTemplate.LookupEntry<SpellEntry>(id);
+        if (!spellInfo)
+            continue;
+
+        // predicates below see SPELL_DERIVED_LOADED unset and evaluate the spell in full without caster and target
+        uint32 flags = 0;
+
+        // spell level results are negative as soon as one effect is negative, independent of others context
+        bool targetModeNegative = false, targetModeContext = false;
+        bool positiveNegative = false, positiveContext = false;
+
+        for (uint32 i = EFFECT_INDEX_0; i < MAX_EFFECT_INDEX; ++i)
+        {
+            SpellEffectIndex effIndex = SpellEffectIndex(i);
+
+            // the IsPositiveEffect switch makes some effects context independent, but it never adds a dependency
+            bool context = IsEffectTargetModeContextDependent(spellInfo, effIndex);
+
+            if (context)
+                flags |= SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_TARGET_MODE_CONTEXT, effIndex) | SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_POSITIVE_CONTEXT, effIndex);
+
+            bool targetModePositive = IsPositiveEffectTargetMode(spellInfo, effIndex);
+            bool positive = IsPositiveEffect(spellInfo, effIndex);
+
+            if (targetModePositive)
+                flags |= SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_TARGET_MODE_POSITIVE, effIndex);
+            if (positive)
+                flags |= SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_POSITIVE, effIndex);
+
+            if (!spellInfo->Effect[i])
+                continue;
+
+            if (context)
+            {
+                targetModeContext = true;
+                positiveContext = true;
+            }
+            else
+            {
+                targetModeNegative |= !targetModePositive;
+                positiveNegative |= !positive;
+            }
+        }
+
+        if (targetModeNegative)
+            targetModeContext = false;
+        else if (!targetModeContext)
+            flags |= SPELL_DERIVED_TARGET_MODE_POSITIVE;
+        if (targetModeContext)
+            flags |= SPELL_DERIVED_TARGET_MODE_CONTEXT;
+
+        if (positiveNegative)
+            positiveContext = false;
+        else if (!positiveContext)
+            flags |= SPELL_DERIVED_POSITIVE;
+        if (positiveContext)
+            flags |= SPELL_DERIVED_POSITIVE_CONTEXT;
+
+        if (IsAreaOfEffectSpell(spellInfo))
+            flags |= SPELL_DERIVED_AREA_OF_EFFECT;
+
+        if (positiveContext)
+            ++contextCount;
+
+        sSpellDerivedFlags[id] = flags | SPELL_DERIVED_LOADED;
+        ++count;
+    }
+
+    sLog.outString(">> Built derived flags for %u spells (%u need caster and target for positive check)", count, contextCount);
+    sLog.outString();
+}
+
 void SpellMgr::LoadSpellElixirs()
 {
     mSpellElixirs.clear();                                  // need for reload case
@@ -35,6 +35,7 @@
 #include "Entities/Unit.h"
 
 #include <map>
+#include <vector>
 
 class Player;
 class Spell;
@@ -80,6 +81,31 @@ enum SpellSpecific
 
 SpellSpecific GetSpellSpecific(uint32 spellId);
 
+// Caster and target independent results of the spell predicates below, built once by SpellMgr::LoadSpellDerivedFlags.
+// A *_CONTEXT bit marks a result that depends on caster/target and must be evaluated in full.
+enum SpellDerivedFlags
+{
+    SPELL_DERIVED_EFFECT_TARGET_MODE_POSITIVE   = 0x00000001,   // 3 bits, IsPositiveEffectTargetMode per effect
+    SPELL_DERIVED_EFFECT_TARGET_MODE_CONTEXT    = 0x00000008,   // 3 bits
+    SPELL_DERIVED_EFFECT_POSITIVE               = 0x00000040,   // 3 bits, IsPositiveEffect per effect
+    SPELL_DERIVED_EFFECT_POSITIVE_CONTEXT       = 0x00000200,   // 3 bits
+    SPELL_DERIVED_TARGET_MODE_POSITIVE          = 0x00001000,   // IsPositiveSpellTargetMode
+    SPELL_DERIVED_TARGET_MODE_CONTEXT           = 0x00002000,
+    SPELL_DERIVED_POSITIVE                      = 0x00004000,   // IsPositiveSpell
+    SPELL_DERIVED_POSITIVE_CONTEXT              = 0x00008000,
+    SPELL_DERIVED_AREA_OF_EFFECT                = 0x00010000,   // IsAreaOfEffectSpell
+    SPELL_DERIVED_LOADED                        = 0x80000000,   // flags are built for this spell
+};
+
+inline uint32 SpellDerivedEffectFlag(SpellDerivedFlags flag, SpellEffectIndex effIndex) { return uint32(flag) << effIndex; }
+
+extern std::vector<uint32> sSpellDerivedFlags;              // indexed by spell id
+
+inline uint32 GetSpellDerivedFlags(SpellEntry const* spellInfo)
+{
+    return spellInfo->Id < sSpellDerivedFlags.size() ? sSpellDerivedFlags[spellInfo->Id] : 0;
+}
+
 // Different spell properties
 inline float GetSpellRadius(SpellRadiusEntry const* radius) { return (radius ? radius->Radius : 0); }
 uint32 GetSpellCastTime(SpellEntry const* spellInfo, Spell const* spell = nullptr);
@@ -586,6 +612,9 @@ inline bool IsAreaEffectTarget(SpellTarget target)
 
 inline bool IsAreaOfEffectSpell(SpellEntry const* spellInfo)
 {
+    uint32 derived = GetSpellDerivedFlags(spellInfo);
+    if (derived & SPELL_DERIVED_LOADED)
+        return (derived & SPELL_DERIVED_AREA_OF_EFFECT) != 0;
 
     if (IsAreaEffectTarget(SpellTarget(spellInfo->EffectImplicitTargetA[EFFECT_INDEX_0])) || IsAreaEffectTarget(SpellTarget(spellInfo->EffectImplicitTargetB[EFFECT_INDEX_0])))
         return true;
@@ -824,7 +853,8 @@ inline bool IsEffectTargetNegative(uint32 targetA, uint32 targetB)
     return (IsHostileTarget(targetA) || IsHostileTarget(targetB));
 }
 
-inline bool IsNeutralEffectTargetPositive(uint32 etarget, const WorldObject* caster = nullptr, const WorldObject* target = nullptr)
+// neutral target modes for which IsNeutralEffectTargetPositive depends on caster and target relations
+inline bool IsNeutralEffectTargetUnitDependent(uint32 etarget)
 {
     switch (etarget)
     {
@@ -847,10 +877,17 @@ inline bool IsNeutralEffectTargetPositive(uint32 etarget, const WorldObject* cas
         case TARGET_UNIT_CASTER_PASSENGER_6:
         case TARGET_UNIT_CASTER_PASSENGER_7:
         case TARGET_UNIT_105_NYI:
-            break;
+            return true;
         default:
-            return true; // Some gameobjects or coords, who cares
+            return false;
     }
+}
+
+inline bool IsNeutralEffectTargetPositive(uint32 etarget, const WorldObject* caster = nullptr, const WorldObject* target = nullptr)
+{
+    if (!IsNeutralEffectTargetUnitDependent(etarget))
+        return true; // Some gameobjects or coords, who cares
+
     if (!target || (target->GetTypeId() != TYPEID_PLAYER && target->GetTypeId() != TYPEID_UNIT))
         return true;
 
@@ -883,6 +920,13 @@ inline bool IsPositiveEffectTargetMode(const SpellEntry* entry, SpellEffectIndex
     if (!entry)
         return false;
 
+    if (!recursive)
+    {
+        uint32 derived = GetSpellDerivedFlags(entry);
+        if ((derived & SPELL_DERIVED_LOADED) && !(derived & SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_TARGET_MODE_CONTEXT, effIndex)))
+            return (derived & SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_TARGET_MODE_POSITIVE, effIndex)) != 0;
+    }
+
     // Triggered spells case: prefer child spell via IsPositiveSpell()-like scan for triggered spell
     if (IsSpellEffectTriggerSpell(entry, effIndex))
     {
@@ -932,6 +976,10 @@ inline bool IsPositiveEffect(const SpellEntry* spellproto, SpellEffectIndex effI
     if (!spellproto)
         return false;
 
+    uint32 derived = GetSpellDerivedFlags(spellproto);
+    if ((derived & SPELL_DERIVED_LOADED) && !(derived & SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_POSITIVE_CONTEXT, effIndex)))
+        return (derived & SpellDerivedEffectFlag(SPELL_DERIVED_EFFECT_POSITIVE, effIndex)) != 0;
+
     switch (spellproto->Effect[effIndex])
     {
         case SPELL_EFFECT_SEND_TAXI:                // Some NPCs that send taxis are neutral, so target mode fails
@@ -1050,6 +1098,10 @@ inline bool IsPositiveSpellTargetMode(const SpellEntry* entry, const WorldObject
 {
     if (!entry)
         return false;
+
+    uint32 derived = GetSpellDerivedFlags(entry);
+    if ((derived & SPELL_DERIVED_LOADED) && !(derived & SPELL_DERIVED_TARGET_MODE_CONTEXT))
+        return (derived & SPELL_DERIVED_TARGET_MODE_POSITIVE) != 0;
     // spells with at least one negative effect are considered negative
     // some self-applied spells have negative effects but in self casting case negative check ignored.
     for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
@@ -1069,6 +1121,10 @@ inline bool IsPositiveSpell(const SpellEntry* entry, const WorldObject* caster =
 {
     if (!entry)
         return false;
+
+    uint32 derived = GetSpellDerivedFlags(entry);
+    if ((derived & SPELL_DERIVED_LOADED) && !(derived & SPELL_DERIVED_POSITIVE_CONTEXT))
+        return (derived & SPELL_DERIVED_POSITIVE) != 0;
     // spells with at least one negative effect are considered negative
     // some self-applied spells have negative effects but in self casting case negative check ignored.
     for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
@@ -1832,6 +1888,7 @@ class SpellMgr
         void CheckUsedSpells(char const* table);
 
         // Loading data at server startup
+        void LoadSpellDerivedFlags();
         void LoadSpellChains();
         void LoadSpellLearnSkills();
         void LoadSpellLearnSpells();
@@ -23,6 +23,7 @@
 #include "Server/DBCStores.h"
 #include "Util/ProgressBar.h"
 #include "Server/SQLStorages.h"
+#include "Entities/UpdateFieldsBlob.h"
 
 void CharacterDatabaseCleaner::CleanDatabase()
 {
@@ -48,6 +49,8 @@ void CharacterDatabaseCleaner::CleanDatabase()
         CleanCharacterSpell();
     if (flags & CLEANING_FLAG_TALENTS)
         CleanCharacterTalent();
+    if (flags & CLEANING_FLAG_UPDATE_FIELDS)
+        ConvertCharacterUpdateFields();
     CharacterDatabase.Execute("UPDATE saved_variables SET cleaning_flags = 0");
 }
 
@@ -138,3 +141,60 @@ void CharacterDatabaseCleaner::CleanCharacterTalent()
 
     CheckUnique("talent_id", "character_talent", &TalentCheck);
 }
+
+void CharacterDatabaseCleaner::ConvertUpdateFields(const char* table, const char* column)
+{
+    QueryResult* result = CharacterDatabase.PQuery("SELECT COUNT(*) FROM %s", table);
+    if (!result)
+        return;
+    uint32 rows = (*result)[0].GetUInt32();
+    delete result;
+
+    std::string sql = std::string("UPDATE ") + table + " SET " + column + " = ? WHERE guid = ?";
+    SqlStatementID updateStmt;
+
+    // rows are read in guid order chunks to keep the result sets small on big databases
+    BarGoLink bar(rows);
+    uint32 lastGuid = 0;
+    uint32 converted = 0;
+    while ((result = CharacterDatabase.PQuery("SELECT guid, %s FROM %s WHERE guid > %u ORDER BY guid LIMIT 10000", column, table, lastGuid)))
+    {
+        CharacterDatabase.BeginTransaction();
+        do
+        {
+            bar.step();
+
+            Field* fields = result->Fetch();
+            lastGuid = fields[0].GetUInt32();
+
+            // broken rows are left for the loader to report
+            std::vector<uint32> values;
+            if (fields[1].IsNULL() || UpdateFieldsBlob::IsBinary(fields[1]) || !UpdateFieldsBlob::Read(fields[1], values))
+                continue;
+
+            std::string data;
+            UpdateFieldsBlob::Write(values.data(), values.size(), data);
+
+            SqlStatement stmt = CharacterDatabase.CreateStatement(updateStmt, sql.c_str());
+            stmt.addBinary(data);
+            stmt.addUInt32(lastGuid);
+            stmt.Execute();
+            ++converted;
+        }
+        while (result->NextRow());
+        CharacterDatabase.CommitTransaction();
+        delete result;
+    }
+
+    sLog.outString(">> Converted %u rows of %s.%s", converted, table, column);
+}
+
+void CharacterDatabaseCleaner::ConvertCharacterUpdateFields()
+{
+    // text stays the storage format on PostgreSQL
+#ifndef DO_POSTGRESQL
+    ConvertUpdateFields("item_instance", "data");
+    ConvertUpdateFields("characters", "exploredZones");
+    ConvertUpdateFields("characters", "knownTitles");
+#endif
+}
@@ -26,7 +26,8 @@ namespace CharacterDatabaseCleaner
         CLEANING_FLAG_ACHIEVEMENT_PROGRESS  = 0x1,
         CLEANING_FLAG_SKILLS                = 0x2,
         CLEANING_FLAG_SPELLS                = 0x4,
-        CLEANING_FLAG_TALENTS               = 0x8
+        CLEANING_FLAG_TALENTS               = 0x8,
+        CLEANING_FLAG_UPDATE_FIELDS         = 0x10          // convert text update fields to the binary format
     };
 
     void CleanDatabase();
@@ -42,6 +43,9 @@ namespace CharacterDatabaseCleaner
     void CleanCharacterSkills();
     void CleanCharacterSpell();
     void CleanCharacterTalent();
+
+    void ConvertUpdateFields(const char* table, const char* column);
+    void ConvertCharacterUpdateFields();
 }
 
 #endif
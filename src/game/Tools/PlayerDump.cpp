@@ -21,6 +21,7 @@
 #include "Database/DatabaseEnv.h"
 #include "Server/SQLStorages.h"
 #include "Entities/UpdateFields.h"
+#include "Entities/UpdateFieldsBlob.h"
 #include "Globals/ObjectMgr.h"
 #include "Accounts/AccountMgr.h"
 
@@ -220,6 +221,16 @@ std::string CreateDumpString(char const* tableName, QueryResult* result)
 
         if (fields[i].IsNULL())
             ss << "NULL";
+        else if (UpdateFieldsBlob::IsBinary(fields[i]))
+        {
+            // dumps keep update fields as text, the loader accepts both formats
+            std::vector<uint32> values;
+            UpdateFieldsBlob::Read(fields[i], values);
+
+            std::string s;
+            UpdateFieldsBlob::WriteText(values.data(), values.size(), s);
+            ss << "'" << s << "'";
+        }
         else
         {
             std::string s =  fields[i].GetCppString();
@@ -460,6 +471,12 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
     snprintf(newpetid, 20, "%u", sObjectMgr.GeneratePetNumber());
     snprintf(lastpetid, 20, "%s", "");
 
+    // identity of the loaded character for the ObjectMgr cache
+    std::string charName;
+    uint8 charRace = 0, charClass = 0, charGender = 0;
+    DeclinedName declinedNames;
+    bool hasDeclinedNames = false;
+
     std::map<uint32, uint32> items;
     std::map<uint32, uint32> mails;
     std::map<uint32, uint32> eqsets;
@@ -542,6 +559,10 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
 
                 if (!changenth(line, 1, newguid))           // character_*.guid update
                     ROLLBACK(DUMP_FILE_BROKEN);
+
+                for (int i = 0; i < MAX_DECLINED_NAME_CASES; ++i)
+                    declinedNames.name[i] = getnth(line, i + 2);
+                hasDeclinedNames = !declinedNames.name[0].empty();
                 break;
 
             case DTT_CHARACTER:
@@ -577,6 +598,10 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
                     nameInvalidated = true;
                 }
 
+                charName = getnth(line, 3);                 // characters.name
+                charRace = uint8(atoi(getnth(line, 4).c_str()));
+                charClass = uint8(atoi(getnth(line, 5).c_str()));
+                charGender = uint8(atoi(getnth(line, 6).c_str()));
                 break;
             }
             case DTT_INVENTORY:
@@ -725,6 +750,8 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
 
     CharacterDatabase.CommitTransaction();
 
+    sObjectMgr.AddCharacterIdentity(ObjectGuid(HIGHGUID_PLAYER, guid), account, charName, charRace, charClass, charGender, hasDeclinedNames ? &declinedNames : nullptr);
+
     // FIXME: current code with post-updating guids not safe for future per-map threads
     sObjectMgr.m_ItemGuids.Set(sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed() + items.size());
     sObjectMgr.m_MailIds.Set(sObjectMgr.m_MailIds.GetNextAfterMaxUsed() +  mails.size());
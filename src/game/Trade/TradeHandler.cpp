@@ -32,9 +32,20 @@
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
 #endif
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+#include "PlayerBot/Base/PlayerbotAI.h"
+#endif
 
 void WorldSession::SendTradeStatus(TradeStatusInfo const& info) const
 {
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    if (PlayerbotAI* ai = _player ? _player->GetPlayerbotAI() : nullptr)
+    {
+        ai->HandleBotEvent(PlayerbotEvent(BOT_EVENT_TRADE_STATUS, ObjectGuid(), info.Status));
+        return;
+    }
+#endif
+
     WorldPacket data(SMSG_TRADE_STATUS, 4 + 8);
 
     data.WriteBit(false);
@@ -723,6 +734,14 @@ void WorldSession::HandleInitiateTradeOpcode(WorldPacket& recvPacket)
     _player->m_trade = new TradeData(_player, pOther);
     pOther->m_trade = new TradeData(pOther, _player);
 
+#ifdef BUILD_DEPRECATED_PLAYERBOT
+    if (PlayerbotAI* ai = pOther->GetPlayerbotAI())
+    {
+        ai->HandleBotEvent(PlayerbotEvent(BOT_EVENT_TRADE_STATUS, _player->GetObjectGuid(), TRADE_STATUS_BEGIN_TRADE));
+        return;
+    }
+#endif
+
     WorldPacket data(SMSG_TRADE_STATUS, 12);
     data.WriteBit(false);
     data.WriteBits(TRADE_STATUS_BEGIN_TRADE, 5);
@@ -0,0 +1,92 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "World/WhoListStorage.h"
+#include "Policies/Singleton.h"
+#include "Entities/Player.h"
+#include "Globals/ObjectAccessor.h"
+#include "Guilds/GuildMgr.h"
+#include "Util/Util.h"
+
+INSTANTIATE_SINGLETON_1(WhoListStorage);
+
+WhoListStorage::WhoListStorage() : m_snapshot(std::make_shared<WhoListSnapshot>())
+{
+}
+
+void WhoListStorage::Update()
+{
+    std::shared_ptr<WhoListSnapshot> snapshot = std::make_shared<WhoListSnapshot>();
+
+    {
+        HashMapHolder<Player>::SnapshotType players = sObjectAccessor.GetPlayersSnapshot();
+
+        snapshot->guidLow.reserve(players.size());
+        snapshot->team.reserve(players.size());
+        snapshot->security.reserve(players.size());
+        snapshot->visibility.reserve(players.size());
+        snapshot->level.reserve(players.size());
+        snapshot->race.reserve(players.size());
+        snapshot->class_.reserve(players.size());
+        snapshot->gender.reserve(players.size());
+        snapshot->zone.reserve(players.size());
+        snapshot->name.reserve(players.size());
+        snapshot->guildName.reserve(players.size());
+        snapshot->lowerName.reserve(players.size());
+        snapshot->lowerGuildName.reserve(players.size());
+
+        for (Player* pl : players)
+        {
+            // players not in world are never listed
+            if (!pl->IsInWorld())
+                continue;
+
+            std::wstring wname;
+            std::string gname = sGuildMgr.GetGuildNameById(pl->GetGuildId());
+            std::wstring wgname;
+            if (!Utf8toWStr(pl->GetName(), wname) || !Utf8toWStr(gname, wgname))
+                continue;
+
+            wstrToLower(wname);
+            wstrToLower(wgname);
+
+            snapshot->guidLow.push_back(pl->GetGUIDLow());
+            snapshot->team.push_back(pl->GetTeam());
+            snapshot->security.push_back(uint8(pl->GetSession()->GetSecurity()));
+            snapshot->visibility.push_back(uint8(pl->GetVisibility()));
+            snapshot->level.push_back(uint8(pl->GetLevel()));
+            snapshot->race.push_back(pl->getRace());
+            snapshot->class_.push_back(pl->getClass());
+            snapshot->gender.push_back(pl->getGender());
+            snapshot->zone.push_back(pl->GetZoneId());
+            snapshot->name.push_back(pl->GetName());
+            snapshot->guildName.push_back(std::move(gname));
+            snapshot->lowerName.push_back(std::move(wname));
+            snapshot->lowerGuildName.push_back(std::move(wgname));
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_snapshot = std::move(snapshot);
+}
+
+std::shared_ptr<WhoListSnapshot const> WhoListStorage::GetSnapshot() const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_snapshot;
+}
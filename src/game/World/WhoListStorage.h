@@ -0,0 +1,79 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_WHO_LIST_STORAGE_H
+#define MANGOS_WHO_LIST_STORAGE_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Online players as seen by /who, one column per attribute and one row per player.
+ *
+ * Filters of a request are first run over the small numeric columns, names are only
+ * compared for the remaining rows. Names are stored lowercased, so requests don't
+ * convert and lowercase every online player name again.
+ */
+struct WhoListSnapshot
+{
+    std::vector<uint32> guidLow;
+    std::vector<uint32> team;
+    std::vector<uint8> security;                            // AccountTypes of the session
+    std::vector<uint8> visibility;                          // UnitVisibility
+    std::vector<uint8> level;
+    std::vector<uint8> race;
+    std::vector<uint8> class_;
+    std::vector<uint8> gender;
+    std::vector<uint32> zone;
+    std::vector<std::string> name;
+    std::vector<std::string> guildName;
+    std::vector<std::wstring> lowerName;
+    std::vector<std::wstring> lowerGuildName;
+
+    size_t Size() const { return guidLow.size(); }
+};
+
+/**
+ * Periodically rebuilt WhoListSnapshot.
+ *
+ * The snapshot is built on the world thread with the player map locked, afterwards it
+ * is never modified, so any thread can filter it without touching Player objects.
+ */
+class WhoListStorage
+{
+    public:
+        WhoListStorage();
+
+        /// Rebuilds the snapshot from the online players, world thread only.
+        void Update();
+        /// Returns the current snapshot, safe to call from any thread.
+        std::shared_ptr<WhoListSnapshot const> GetSnapshot() const;
+
+    private:
+        std::shared_ptr<WhoListSnapshot const> m_snapshot;
+        mutable std::mutex m_lock;
+};
+
+#define sWhoListStorage MaNGOS::Singleton<WhoListStorage>::Instance()
+
+#endif
@@ -70,6 +70,7 @@
 #include "Calendar/Calendar.h"
 #include "Weather/Weather.h"
 #include "World/WorldState.h"
+#include "World/WhoListStorage.h"
 
 #ifdef BUILD_ELUNA
 #include "LuaEngine/LuaEngine.h"
@@ -157,6 +158,7 @@ void World::CleanupsBeforeStop()
     UpdateSessions(1);                               // real players unload required UpdateSessions call
     sBattleGroundMgr.DeleteAllBattleGrounds();       // unload battleground templates before different singletons destroyed
     sMapMgr.UnloadAll();                             // unload all grids (including locked in memory)
+    sMapPersistentStateMgr.FlushRespawnTimes();      // write respawn times still queued (also the ones saved at grid unload)
 }
 
 /// Find a session by its id
@@ -521,6 +523,8 @@ void World::LoadConfigSettings(bool reload)
     if (reload)
         sMapMgr.SetGridCleanUpDelay(getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN));
 
+    setConfig(CONFIG_UINT32_GRID_UNLOAD_BUDGET, "GridUnload.Budget", 5);
+
     setConfigMin(CONFIG_UINT32_INTERVAL_MAPUPDATE, "MapUpdateInterval", 100, MIN_MAP_UPDATE_DELAY);
     if (reload)
         sMapMgr.SetMapUpdateInterval(getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
@@ -659,6 +663,7 @@ void World::LoadConfigSettings(bool reload)
     }
 
     setConfig(CONFIG_BOOL_SAVE_RESPAWN_TIME_IMMEDIATELY, "SaveRespawnTimeImmediately", true);
+    setConfig(CONFIG_UINT32_INTERVAL_RESPAWN_SAVE, "SaveRespawnTimeInterval", 10 * IN_MILLISECONDS);
     setConfig(CONFIG_BOOL_WEATHER, "ActivateWeather", true);
 
     if (configNoReload(reload, CONFIG_UINT32_EXPANSION, "Expansion", MAX_EXPANSION))
@@ -1025,6 +1030,9 @@ void World::SetInitialWorldSettings()
     LoadGameObjectModelList();
     sLog.outString();
 
+    sLog.outString("Building Spell derived flags...");
+    sSpellMgr.LoadSpellDerivedFlags();
+
     sLog.outString("Loading Spell Chain Data...");
     sSpellMgr.LoadSpellChains();
 
@@ -1319,6 +1327,9 @@ void World::SetInitialWorldSettings()
     sLog.outString();
 
     ///- Load dynamic data tables from the database
+    sLog.outString("Loading Character identities...");
+    sObjectMgr.LoadCharacterIdentities();
+
     sLog.outString("Loading Auctions...");
     sAuctionMgr.LoadAuctionItems();
     sAuctionMgr.LoadAuctions();
@@ -1402,6 +1413,9 @@ void World::SetInitialWorldSettings()
     // Update groups with offline leader after delay in seconds
     m_timers[WUPDATE_GROUPS].SetInterval(IN_MILLISECONDS);
 
+    // /who answers from a snapshot of the online players at most this old
+    m_timers[WUPDATE_WHO_LIST].SetInterval(2 * IN_MILLISECONDS);
+
     // to set mailtimer to return mails every day between 4 and 5 am
     // mailtimer is increased when updating auctions
     // one second is 1000 -(tested on win system)
@@ -1599,6 +1613,13 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_AHBOT].Reset();
     }
 
+    /// <li> Refresh the online player snapshot used by /who
+    if (m_timers[WUPDATE_WHO_LIST].Passed())
+    {
+        m_timers[WUPDATE_WHO_LIST].Reset();
+        sWhoListStorage.Update();
+    }
+
     /// <li> Handle session updates
     UpdateSessions(diff);
 
@@ -1671,7 +1692,7 @@ void World::Update(uint32 diff)
     sMapMgr.RemoveAllObjectsInRemoveList();
 
     // update the instance reset times
-    sMapPersistentStateMgr.Update();
+    sMapPersistentStateMgr.Update(diff);
 
     // And last, but not least handle the issued cli commands
     ProcessCliCommands();
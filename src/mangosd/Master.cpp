@@ -219,7 +219,11 @@ int Master::Run()
             sLog.outError("Invalid network thread workers setting in mangosd.conf. (%d) should be > 0", networkThreadWorker);
             networkThreadWorker = 1;
         }
-        MaNGOS::Listener<WorldSocket> listener(sConfig.GetStringDefault("BindIP", "0.0.0.0"), int32(sWorld.getConfig(CONFIG_UINT32_PORT_WORLD)), networkThreadWorker);
+        // account lookups of CMSG_AUTH_SESSION, stopped while the network threads of the listener still run
+        WorldSocket::StartAuthWorkers(sConfig.GetIntDefault("Network.AuthThreads", 2));
+
+        MaNGOS::Listener<WorldSocket> listener(sConfig.GetStringDefault("BindIP", "0.0.0.0"), int32(sWorld.getConfig(CONFIG_UINT32_PORT_WORLD)), networkThreadWorker,
+                                               sConfig.GetBoolDefault("Network.ReusePort", false));
 
         std::unique_ptr<MaNGOS::Listener<RASocket>> raListener;
         if (sConfig.GetBoolDefault("Ra.Enable", false))
@@ -234,6 +238,9 @@ int Master::Run()
             std::this_thread::sleep_for(std::chrono::seconds(1));
 
         world_thread.wait();
+
+        // queued auth requests resume their sockets on the listener io_contexts, finish them first
+        WorldSocket::StopAuthWorkers();
     }
 
     ///- Stop freeze protection before shutdown tasks
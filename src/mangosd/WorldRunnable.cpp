@@ -30,6 +30,7 @@
 #endif
 
 #include "Database/DatabaseEnv.h"
+#include "Database/SqlOperations.h"
 
 #define WORLD_SLEEP_CONST 50
 
@@ -62,10 +63,17 @@ void WorldRunnable::run()
         diffTime = WorldTimer::getMSTime() - WorldTimer::tickTime();
 
         // we have to wait WORLD_SLEEP_CONST max between loops
-        // don't wait if over
+        // don't wait if over, async query results arriving while waiting are delivered at once
         if (diffTime < WORLD_SLEEP_CONST)
         {
-            MaNGOS::Thread::Sleep(WORLD_SLEEP_CONST - diffTime);
+            do
+            {
+                if (SqlResultQueue::WaitForResults(WORLD_SLEEP_CONST - diffTime))
+                    sWorld.UpdateResultQueue();
+
+                diffTime = WorldTimer::getMSTime() - WorldTimer::tickTime();
+            }
+            while (diffTime < WORLD_SLEEP_CONST);
         }
 #ifdef MANGOS_DEBUG
         else
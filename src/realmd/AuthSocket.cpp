@@ -35,6 +35,8 @@
 #include <openssl/md5.h>
 #include <ctime>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 //#include "Util/Util.h" -- for commented utf8ToUpperOnlyLatin
@@ -177,6 +179,31 @@ typedef struct AuthHandler
 
 std::array<uint8, 16> VersionChallenge = { { 0xBA, 0xA3, 0x1E, 0x99, 0xA0, 0x0B, 0x21, 0x57, 0xFC, 0x37, 0x3F, 0xB3, 0x69, 0xCD, 0xD2, 0xF1 } };
 
+std::unique_ptr<MaNGOS::WorkerPool> AuthSocket::s_workers;
+std::mutex AuthSocket::s_workersLock;
+
+void AuthSocket::StartWorkers(int threads)
+{
+    std::unique_ptr<MaNGOS::WorkerPool> workers(new MaNGOS::WorkerPool(threads,
+        []() { LoginDatabase.ThreadStart(); },              // let thread do safe mySQL requests
+        []() { LoginDatabase.ThreadEnd(); }));              // free mySQL thread resources
+
+    std::lock_guard<std::mutex> guard(s_workersLock);
+    s_workers.swap(workers);
+}
+
+void AuthSocket::StopWorkers()
+{
+    std::unique_ptr<MaNGOS::WorkerPool> workers;
+    {
+        std::lock_guard<std::mutex> guard(s_workersLock);
+        workers.swap(s_workers);
+    }
+
+    // finishes the queued handlers, network threads still running fall back to handling commands themselves
+    workers.reset();
+}
+
 /// Constructor - set the N and g values for SRP6
 AuthSocket::AuthSocket(boost::asio::io_context& context, std::function<void (Socket*)> closeHandler)
     : Socket(context, std::move(closeHandler)), _status(STATUS_CHALLENGE), _build(0), _accountSecurityLevel(SEC_PLAYER), m_timeoutTimer(context)
@@ -220,7 +247,8 @@ bool AuthSocket::ProcessIncomingData()
 
     // the purpose of this loop is to handle multiple opcodes in the same tcp packet,
     // which presumably the client will never do, but lets support it anyway! \o/
-    while (ReadLengthRemaining() > 0)
+    // a deferred handler continues with the rest of the data once it is done
+    while (ReadLengthRemaining() > 0 && !IsProcessingDeferred())
     {
         const eAuthCmd cmd = static_cast<eAuthCmd>(*InPeak());
         int i;
@@ -242,7 +270,30 @@ bool AuthSocket::ProcessIncomingData()
 
             DEBUG_LOG("[Auth] Got data for cmd %u recv length %u", cmd, ReadLengthRemaining());
 
-            if (!(*this.*table[i].handler)())
+            bool (AuthSocket::*handler)(void) = table[i].handler;
+
+            // handlers do blocking database queries and SRP6 calculations, run them on the auth workers
+            {
+                std::lock_guard<std::mutex> guard(s_workersLock);
+                if (s_workers)
+                {
+                    ProcessDeferred(s_workers->GetContext(), [this, cmd, handler]()
+                    {
+                        if (!(*this.*handler)())
+                        {
+                            DEBUG_LOG("[Auth] Command handler failed for cmd %u recv length %u", cmd, ReadLengthRemaining());
+                            return false;
+                        }
+
+                        return true;
+                    });
+
+                    break;
+                }
+            }
+
+            // workers are already stopped at shutdown, handle the command here
+            if (!(*this.*handler)())
             {
                 DEBUG_LOG("[Auth] Command handler failed for cmd %u recv length %u", cmd, ReadLengthRemaining());
                 return false;
@@ -818,9 +869,6 @@ bool AuthSocket::_HandleRealmList()
     uint8 accountSecurityLevel = (*result)[1].GetUInt8();
     delete result;
 
-    ///- Update realm list if need
-    sRealmList.UpdateIfNeed();
-
     ///- Circle through realms in the RealmList and construct the return packet (including # of user characters in each realm)
     ByteBuffer pkt;
     LoadRealmlist(pkt, id, accountSecurityLevel);
@@ -836,6 +884,24 @@ bool AuthSocket::_HandleRealmList()
 
 void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLevel)
 {
+    // characters of the account on all realms in one query
+    std::unordered_map<uint32, uint8> charCounts;
+    if (QueryResult* result = LoginDatabase.PQuery("SELECT realmid, numchars FROM realmcharacters WHERE acctid = '%u'", acctid))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            charCounts[fields[0].GetUInt32()] = fields[1].GetUInt8();
+        }
+        while (result->NextRow());
+
+        delete result;
+    }
+
+    ///- Update realm list if need, other workers may build realm lists meanwhile
+    std::lock_guard<std::mutex> guard(sRealmList.GetLock());
+    sRealmList.UpdateIfNeed();
+
     switch (_build)
     {
         case 5875:                                          // 1.12.1
@@ -847,18 +913,8 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
 
             for (const auto& i : sRealmList)
             {
-                uint8 AmountOfCharacters;
-
-                // No SQL injection. id of realm is controlled by the database.
-                QueryResult* result = LoginDatabase.PQuery("SELECT numchars FROM realmcharacters WHERE realmid = '%d' AND acctid='%u'", i.second.m_ID, acctid);
-                if (result)
-                {
-                    Field* fields = result->Fetch();
-                    AmountOfCharacters = fields[0].GetUInt8();
-                    delete result;
-                }
-                else
-                    AmountOfCharacters = 0;
+                auto numChars = charCounts.find(i.second.m_ID);
+                uint8 AmountOfCharacters = numChars != charCounts.end() ? numChars->second : 0;
 
                 bool ok_build = std::find(i.second.realmbuilds.begin(), i.second.realmbuilds.end(), _build) != i.second.realmbuilds.end();
 
@@ -915,18 +971,8 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 securityLev
 
             for (const auto& i : sRealmList)
             {
-                uint8 AmountOfCharacters;
-
-                // No SQL injection. id of realm is controlled by the database.
-                QueryResult* result = LoginDatabase.PQuery("SELECT numchars FROM realmcharacters WHERE realmid = '%d' AND acctid='%u'", i.second.m_ID, acctid);
-                if (result)
-                {
-                    Field* fields = result->Fetch();
-                    AmountOfCharacters = fields[0].GetUInt8();
-                    delete result;
-                }
-                else
-                    AmountOfCharacters = 0;
+                auto numChars = charCounts.find(i.second.m_ID);
+                uint8 AmountOfCharacters = numChars != charCounts.end() ? numChars->second : 0;
 
                 bool ok_build = std::find(i.second.realmbuilds.begin(), i.second.realmbuilds.end(), _build) != i.second.realmbuilds.end();
 
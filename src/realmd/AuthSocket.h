@@ -30,10 +30,13 @@
 #include "Util/ByteBuffer.h"
 
 #include "Network/Socket.hpp"
+#include "Network/WorkerPool.hpp"
 
 #include <boost/asio.hpp>
 
 #include <functional>
+#include <memory>
+#include <mutex>
 
 #define HMAC_RES_SIZE 20
 
@@ -46,6 +49,10 @@ class AuthSocket : public MaNGOS::Socket
 
         bool Open() override;
 
+        // worker threads running the command handlers of all auth sockets
+        static void StartWorkers(int threads);
+        static void StopWorkers();
+
         void SendProof(Sha1Hash sha);
         void LoadRealmlist(ByteBuffer& pkt, uint32 acctid, uint8 accountSecurityLevel = 0);
         int32 generateToken(char const* b32key);
@@ -92,6 +99,9 @@ class AuthSocket : public MaNGOS::Socket
 
         boost::asio::deadline_timer m_timeoutTimer;
 
+        static std::unique_ptr<MaNGOS::WorkerPool> s_workers;
+        static std::mutex s_workersLock;
+
         virtual bool ProcessIncomingData() override;
 };
 #endif
@@ -234,11 +234,15 @@ int main(int argc, char* argv[])
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE expires_at<=UNIX_TIMESTAMP() AND expires_at<>banned_at");
     LoginDatabase.CommitTransaction();
 
+    ///- Start the workers running database queries and SRP6 calculations of the auth sockets
+    AuthSocket::StartWorkers(sConfig.GetIntDefault("AuthWorkerThreads", 2));
+
     // FIXME - more intelligent selection of thread count is needed here.  config option?
     MaNGOS::Listener<AuthSocket> listener(
             sConfig.GetStringDefault("BindIP", "0.0.0.0"),
             sConfig.GetIntDefault("RealmServerPort", DEFAULT_REALMSERVER_PORT),
-            sConfig.GetIntDefault("ListenerThreads", 1)
+            sConfig.GetIntDefault("ListenerThreads", 1),
+            sConfig.GetBoolDefault("ListenerReusePort", false)
     );
 
     ///- Catch termination signals
@@ -313,6 +317,9 @@ int main(int argc, char* argv[])
 #endif
     }
 
+    ///- Finish pending auth work before the database goes away
+    AuthSocket::StopWorkers();
+
     ///- Wait for the delay thread to exit
     LoginDatabase.HaltDelayThread();
 
@@ -353,9 +360,11 @@ bool StartDB()
         return false;
     }
 
-    sLog.outString("Login Database total connections: %i", 1 + 1);
+    int nConnections = sConfig.GetIntDefault("LoginDatabaseConnections", 1);
+
+    sLog.outString("Login Database total connections: %i", nConnections + 1);
 
-    if (!LoginDatabase.Initialize(dbstring.c_str()))
+    if (!LoginDatabase.Initialize(dbstring.c_str(), nConnections))
     {
         sLog.outError("Cannot connect to database");
         return false;
@@ -25,6 +25,7 @@
 
 #include "Common.h"
 #include <array>
+#include <mutex>
 
 struct RealmBuildInfo
 {
@@ -70,6 +71,9 @@ class RealmList
 
         void UpdateIfNeed();
 
+        // realm lists are built by several auth workers, hold this while updating or iterating the realms
+        std::mutex& GetLock() { return m_lock; }
+
         RealmMap::const_iterator begin() const { return m_realms.begin(); }
         RealmMap::const_iterator end() const { return m_realms.end(); }
         uint32 size() const { return m_realms.size(); }
@@ -80,6 +84,7 @@ class RealmList
         RealmMap m_realms;                                  ///< Internal map of realms
         uint32   m_UpdateInterval;
         time_t   m_NextUpdateTime;
+        std::mutex m_lock;
 };
 
 #define sRealmList RealmList::Instance()
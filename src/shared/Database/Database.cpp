@@ -25,6 +25,7 @@
 #include <fstream>
 #include <memory>
 #include <cstdarg>
+#include <algorithm>
 
 #define MIN_CONNECTION_POOL_SIZE 1
 #define MAX_CONNECTION_POOL_SIZE 16
@@ -44,6 +45,11 @@ void SqlConnection::FreePreparedStatements()
         delete m_holder[i];
 
     m_holder.clear();
+
+    for (InsertBatchHolder::iterator itr = m_insertBatches.begin(); itr != m_insertBatches.end(); ++itr)
+        delete itr->row;
+
+    m_insertBatches.clear();
 }
 
 SqlPreparedStatement* SqlConnection::GetStmt(uint32 nIndex)
@@ -91,6 +97,101 @@ bool SqlConnection::ExecuteStmt(int nIndex, const SqlStmtParameters& id)
     return pStmt->execute();
 }
 
+SqlConnection::InsertBatch& SqlConnection::GetInsertBatch(uint32 nIndex)
+{
+    if (m_insertBatches.size() <= nIndex)
+        m_insertBatches.resize(nIndex + 1);
+
+    InsertBatch& batch = m_insertBatches[nIndex];
+    if (batch.checked)
+        return batch;
+
+    batch.checked = true;
+
+    std::string fmt = m_db.GetStmtString(nIndex);
+    std::string upper(fmt);
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+    // only "INSERT/REPLACE ... VALUES (...)" with a single tuple ending the statement can be merged
+    if (upper.compare(0, 6, "INSERT") != 0 && upper.compare(0, 7, "REPLACE") != 0)
+        return batch;
+
+    size_t valuesPos = upper.rfind("VALUES");
+    if (valuesPos == std::string::npos)
+        return batch;
+
+    size_t rowStart = fmt.find_first_not_of(" \t\r\n", valuesPos + 6);
+    size_t rowEnd = fmt.find_last_not_of(" \t\r\n;");
+    if (rowStart == std::string::npos || rowEnd == std::string::npos || rowEnd <= rowStart || fmt[rowStart] != '(' || fmt[rowEnd] != ')')
+        return batch;
+
+    // quoted literals could hide parentheses, leave such statements alone
+    if (fmt.find_first_of("'\"`", rowStart) != std::string::npos)
+        return batch;
+
+    int depth = 0;
+    for (size_t i = rowStart; i <= rowEnd; ++i)
+    {
+        if (fmt[i] == '(')
+            ++depth;
+        else if (fmt[i] == ')' && --depth == 0 && i != rowEnd)
+            return batch;                                   // more than one tuple or trailing clause
+    }
+
+    batch.prefix = fmt.substr(0, rowStart);
+    batch.row = new SqlPlainPreparedStatement(fmt.substr(rowStart, rowEnd - rowStart + 1), *this);
+    return batch;
+}
+
+bool SqlConnection::IsBatchableStmt(int nIndex)
+{
+    if (nIndex == -1)
+        return false;
+
+    return GetInsertBatch(nIndex).row != nullptr;
+}
+
+bool SqlConnection::ExecuteStmtBatch(int nIndex, std::vector<SqlStmtParameters const*> const& params, uint32& roundTrips)
+{
+    if (nIndex == -1)
+        return false;
+
+    InsertBatch& batch = GetInsertBatch(nIndex);
+    if (!batch.row)
+    {
+        for (std::vector<SqlStmtParameters const*>::const_iterator itr = params.begin(); itr != params.end(); ++itr)
+        {
+            ++roundTrips;
+            if (!ExecuteStmt(nIndex, **itr))
+                return false;
+        }
+        return true;
+    }
+
+    std::string sql;
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+        batch.row->bind(*params[i]);
+
+        if (sql.empty())
+            sql = batch.prefix;
+        else
+            sql += ',';
+        sql += batch.row->GetPlainRequest();
+
+        if (sql.length() >= MAX_BATCH_QUERY_LEN || i + 1 == params.size())
+        {
+            ++roundTrips;
+            if (!Execute(sql.c_str()))
+                return false;
+
+            sql.clear();
+        }
+    }
+
+    return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 Database::~Database()
 {
@@ -36,6 +36,8 @@ class SqlParamBinder;
 class Database;
 
 #define MAX_QUERY_LEN   (32*1024)
+// merged multi-row INSERTs are flushed once they grow past this size
+#define MAX_BATCH_QUERY_LEN (256*1024)
 
 //
 class SqlConnection
@@ -63,6 +65,10 @@ class SqlConnection
 
         // methods to work with prepared statements
         bool ExecuteStmt(int nIndex, const SqlStmtParameters& id);
+        // true if executions of the statement can be merged by ExecuteStmtBatch()
+        bool IsBatchableStmt(int nIndex);
+        // execute a single row INSERT once per parameter set, merged into multi-row INSERTs
+        bool ExecuteStmtBatch(int nIndex, std::vector<SqlStmtParameters const*> const& params, uint32& roundTrips);
 
         // SqlConnection object lock
         class Lock
@@ -97,6 +103,21 @@ class SqlConnection
 
         typedef std::vector<SqlPreparedStatement* > StmtHolder;
         StmtHolder m_holder;
+
+        // multi-row form of a single row "INSERT ... VALUES (...)" statement
+        struct InsertBatch
+        {
+            InsertBatch() : checked(false), row(nullptr) {}
+
+            bool checked;
+            std::string prefix;                             // statement text up to the VALUES tuple
+            SqlPlainPreparedStatement* row;                 // the VALUES tuple, nullptr if the statement can't be merged
+        };
+
+        InsertBatch& GetInsertBatch(uint32 nIndex);
+
+        typedef std::vector<InsertBatch> InsertBatchHolder;
+        InsertBatchHolder m_insertBatches;
 };
 
 class Database
@@ -208,6 +229,18 @@ class Database
 
         // set database-wide result queue. also we should use object-bases and not thread-based result queues
         void ProcessResultQueue();
+        SqlResultQueue const* GetResultQueue() const { return m_pResultQueue; }
+
+        // transaction statistics, round trips are lower than statements when INSERTs were merged
+        void AddTransactionStats(uint32 statements, uint32 roundTrips)
+        {
+            ++m_transactionCount;
+            m_transactionStatements += statements;
+            m_transactionRoundTrips += roundTrips;
+        }
+        uint64 GetTransactionCount() const { return m_transactionCount; }
+        uint64 GetTransactionStatements() const { return m_transactionStatements; }
+        uint64 GetTransactionRoundTrips() const { return m_transactionRoundTrips; }
 
         bool CheckRequiredField(char const* table_name, char const* required_name);
         uint32 GetPingIntervall() const { return m_pingIntervallms; }
@@ -224,7 +257,8 @@ class Database
         Database() :
             m_nQueryConnPoolSize(1), m_pAsyncConn(nullptr), m_pResultQueue(nullptr),
             m_threadBody(nullptr), m_delayThread(nullptr), m_allowAsyncTransactions(false),
-            m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0)
+            m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0),
+            m_transactionCount(0), m_transactionStatements(0), m_transactionRoundTrips(0)
         {
             m_nQueryCounter = -1;
         }
@@ -285,5 +319,9 @@ class Database
         bool m_logSQL;
         std::string m_logsDir;
         uint32 m_pingIntervallms;
+
+        std::atomic<uint64> m_transactionCount;
+        std::atomic<uint64> m_transactionStatements;
+        std::atomic<uint64> m_transactionRoundTrips;
 };
 #endif
@@ -424,7 +424,7 @@ void MySqlPreparedStatement::addParam(unsigned int nIndex, const SqlStmtFieldDat
     pData.is_unsigned = bUnsigned;
     pData.buffer = data.buff();
     pData.length = nullptr;
-    pData.buffer_length = data.type() == FIELD_STRING ? data.size() : 0;
+    pData.buffer_length = data.type() == FIELD_STRING || data.type() == FIELD_BINARY ? data.size() : 0;
 }
 
 void MySqlPreparedStatement::RemoveBinds()
@@ -482,6 +482,7 @@ enum_field_types MySqlPreparedStatement::ToMySQLType(const SqlStmtFieldData& dat
         case FIELD_FLOAT:   dataType = MYSQL_TYPE_FLOAT;                    break;
         case FIELD_DOUBLE:  dataType = MYSQL_TYPE_DOUBLE;                   break;
         case FIELD_STRING:  dataType = MYSQL_TYPE_STRING;                   break;
+        case FIELD_BINARY:  dataType = MYSQL_TYPE_BLOB;                     break;
     }
 
     return dataType;
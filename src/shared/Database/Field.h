@@ -34,13 +34,15 @@ class Field
             DB_TYPE_BOOL    = 0x04
         };
 
-        Field() : mValue(nullptr), mType(DB_TYPE_UNKNOWN) {}
-        Field(const char* value, enum DataTypes type) : mValue(value), mType(type) {}
+        Field() : mValue(nullptr), mLength(0), mType(DB_TYPE_UNKNOWN) {}
+        Field(const char* value, enum DataTypes type) : mValue(value), mLength(value ? strlen(value) : 0), mType(type) {}
 
         ~Field() {}
 
         enum DataTypes GetType() const { return mType; }
         bool IsNULL() const { return mValue == nullptr; }
+        // size of the value in bytes, BLOB values may contain zero bytes
+        size_t GetLength() const { return mValue ? mLength : 0; }
 
         const char* GetString() const
         {
@@ -82,13 +84,14 @@ class Field
         void SetType(enum DataTypes type) { mType = type; }
         // no need for memory allocations to store resultset field strings
         // all we need is to cache pointers returned by different DBMS APIs
-        void SetValue(const char* value) { mValue = value; }
+        void SetValue(const char* value, size_t length) { mValue = value; mLength = length; }
 
     private:
         Field(Field const&);
         Field& operator=(Field const&);
 
         const char* mValue;
+        size_t mLength;
         enum DataTypes mType;
 };
 #endif
@@ -48,8 +48,9 @@ bool QueryResultMysql::NextRow()
         return false;
     }
 
+    unsigned long* lengths = mysql_fetch_lengths(mResult);
     for (uint32 i = 0; i < mFieldCount; ++i)
-        mCurrentRow[i].SetValue(row[i]);
+        mCurrentRow[i].SetValue(row[i], lengths[i]);
 
     return true;
 }
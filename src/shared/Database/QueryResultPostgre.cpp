@@ -54,7 +54,7 @@ bool QueryResultPostgre::NextRow()
         if (pPQgetvalue && !(*pPQgetvalue))
             pPQgetvalue = nullptr;
 
-        mCurrentRow[j].SetValue(pPQgetvalue);
+        mCurrentRow[j].SetValue(pPQgetvalue, pPQgetvalue ? PQgetlength(mResult, mTableIndex, j) : 0);
     }
     ++mTableIndex;
 
@@ -36,22 +36,25 @@ void SqlDelayThread::run()
     mysql_thread_init();
 #endif
 
-    const uint32 loopSleepms = 10;
+    // clamp to one minute, MaxPingTime = 0 would make the wait below return at once and spin
+    const std::chrono::milliseconds pingInterval(std::max(m_dbEngine->GetPingIntervall(), uint32(MINUTE * IN_MILLISECONDS)));
+    std::chrono::steady_clock::time_point nextPing = std::chrono::steady_clock::now() + pingInterval;
 
-    const uint32 pingEveryLoop = m_dbEngine->GetPingIntervall() / loopSleepms;
-
-    uint32 loopCounter = 0;
     while (m_running)
     {
+        // sleep until something is queued, the connection needs a ping or the thread is stopped
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait_until(lock, nextPing, [this] { return !m_sqlQueue.empty() || !m_running; });
+        }
+
         // if the running state gets turned off while sleeping
         // empty the queue before exiting
-        MaNGOS::Thread::Sleep(loopSleepms);
-
         ProcessRequests();
 
-        if ((loopCounter++) >= pingEveryLoop)
+        if (std::chrono::steady_clock::now() >= nextPing)
         {
-            loopCounter = 0;
+            nextPing = std::chrono::steady_clock::now() + pingInterval;
             m_dbEngine->Ping();
         }
     }
@@ -63,7 +66,11 @@ void SqlDelayThread::run()
 
 void SqlDelayThread::Stop()
 {
-    m_running = false;
+    {
+        std::lock_guard<std::mutex> guard(m_queueMutex);
+        m_running = false;
+    }
+    m_queueCondition.notify_one();
 }
 
 void SqlDelayThread::ProcessRequests()
@@ -74,7 +81,7 @@ void SqlDelayThread::ProcessRequests()
     // lock in place can result in a deadlock with the world thread which calls Database::ProcessResultQueue()
     {
         std::lock_guard<std::mutex> guard(m_queueMutex);
-        sqlQueue = std::move(m_sqlQueue);
+        sqlQueue.swap(m_sqlQueue);
     }
 
     while (!sqlQueue.empty())
@@ -23,6 +23,7 @@
 #include "SqlOperations.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -35,6 +36,7 @@ class SqlDelayThread : public MaNGOS::Runnable
 {
     private:
         std::mutex m_queueMutex;
+        std::condition_variable m_queueCondition;               ///< Wakes the thread when a statement is queued or on stop
         std::queue<std::unique_ptr<SqlOperation>> m_sqlQueue;   ///< Queue of SQL statements
         Database* m_dbEngine;                                   ///< Pointer to used Database engine
         SqlConnection* m_dbConnection;                          ///< Pointer to DB connection
@@ -50,8 +52,11 @@ class SqlDelayThread : public MaNGOS::Runnable
         ///< Put sql statement to delay queue
         bool Delay(SqlOperation* sql)
         {
-            std::lock_guard<std::mutex> guard(m_queueMutex);
-            m_sqlQueue.push(std::unique_ptr<SqlOperation>(sql));
+            {
+                std::lock_guard<std::mutex> guard(m_queueMutex);
+                m_sqlQueue.push(std::unique_ptr<SqlOperation>(sql));
+            }
+            m_queueCondition.notify_one();
             return true;
         }
 
@@ -52,18 +52,53 @@ bool SqlTransaction::Execute(SqlConnection* conn)
 
     conn->BeginTransaction();
 
+    uint32 roundTrips = 0;
     const int nItems = m_queue.size();
-    for (int i = 0; i < nItems; ++i)
+    for (int i = 0; i < nItems;)
     {
         SqlOperation* pStmt = m_queue[i];
 
-        if (!pStmt->Execute(conn))
+        // consecutive executions of the same single row INSERT are sent as multi-row INSERTs
+        int nBatchEnd = i + 1;
+        SqlPreparedRequest* pRequest = dynamic_cast<SqlPreparedRequest*>(pStmt);
+        if (pRequest && conn->IsBatchableStmt(pRequest->GetIndex()))
+        {
+            while (nBatchEnd < nItems)
+            {
+                SqlPreparedRequest* pNext = dynamic_cast<SqlPreparedRequest*>(m_queue[nBatchEnd]);
+                if (!pNext || pNext->GetIndex() != pRequest->GetIndex())
+                    break;
+                ++nBatchEnd;
+            }
+        }
+
+        bool result;
+        if (nBatchEnd - i > 1)
+        {
+            std::vector<SqlStmtParameters const*> params;
+            params.reserve(nBatchEnd - i);
+            for (int j = i; j < nBatchEnd; ++j)
+                params.push_back(&static_cast<SqlPreparedRequest*>(m_queue[j])->GetParams());
+
+            result = conn->ExecuteStmtBatch(pRequest->GetIndex(), params, roundTrips);
+        }
+        else
+        {
+            ++roundTrips;
+            result = pStmt->Execute(conn);
+        }
+
+        if (!result)
         {
             conn->RollbackTransaction();
+            conn->DB().AddTransactionStats(nItems, roundTrips);
             return false;
         }
+
+        i = nBatchEnd;
     }
 
+    conn->DB().AddTransactionStats(nItems, roundTrips);
     return conn->CommitTransaction();
 }
 
@@ -93,28 +128,67 @@ bool SqlQuery::Execute(SqlConnection* conn)
     /// execute the query and store the result in the callback
     m_callback->SetResult(conn->Query(&m_sql[0]));
     /// add the callback to the sql result queue of the thread it originated from
-    m_queue->Add(m_callback);
+    m_queue->Add(m_callback, m_requestTime);
 
     return true;
 }
 
+uint32 const SqlResultQueue::LatencyHistogram::BucketLimits[SQL_RESULT_LATENCY_BUCKETS - 1] = { 2, 5, 10, 25, 50, 100, 250 };
+
+std::mutex SqlResultQueue::m_signalMutex;
+std::condition_variable SqlResultQueue::m_signal;
+bool SqlResultQueue::m_signaled = false;
+
 void SqlResultQueue::Update()
 {
-    std::lock_guard<std::mutex> guard(m_mutex);
+    /// take the waiting callbacks out first, so the delay thread isn't blocked while they run
+    std::queue<Entry> queue;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        queue.swap(m_queue);
+    }
 
     /// execute the callbacks waiting in the synchronization queue
-    while (!m_queue.empty())
+    uint32 now = WorldTimer::getMSTime();
+    while (!queue.empty())
+    {
+        Entry entry = std::move(queue.front());
+        queue.pop();
+
+        uint32 latency = WorldTimer::getMSTimeDiff(entry.requestTime, now);
+        uint32 bucket = 0;
+        while (bucket < SQL_RESULT_LATENCY_BUCKETS - 1 && latency >= LatencyHistogram::BucketLimits[bucket])
+            ++bucket;
+
+        ++m_latency.buckets[bucket];
+        ++m_latency.samples;
+        m_latency.totalTime += latency;
+        m_latency.maxTime = std::max(m_latency.maxTime, latency);
+
+        entry.callback->Execute();
+    }
+}
+
+void SqlResultQueue::Add(MaNGOS::IQueryCallback* callback, uint32 requestTime)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_queue.push(Entry(callback, requestTime));
+    }
+
     {
-        auto const callback = std::move(m_queue.front());
-        m_queue.pop();
-        callback->Execute();
+        std::lock_guard<std::mutex> guard(m_signalMutex);
+        m_signaled = true;
     }
+    m_signal.notify_all();
 }
 
-void SqlResultQueue::Add(MaNGOS::IQueryCallback* callback)
+bool SqlResultQueue::WaitForResults(uint32 timeMs)
 {
-    std::lock_guard<std::mutex> guard(m_mutex);
-    m_queue.push(std::unique_ptr<MaNGOS::IQueryCallback>(callback));
+    std::unique_lock<std::mutex> lock(m_signalMutex);
+    bool signaled = m_signal.wait_for(lock, std::chrono::milliseconds(timeMs), [] { return m_signaled; });
+    m_signaled = false;
+    return signaled;
 }
 
 bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue)
@@ -231,7 +305,7 @@ bool SqlQueryHolderEx::Execute(SqlConnection* conn)
     }
 
     /// sync with the caller thread
-    m_queue->Add(m_callback);
+    m_queue->Add(m_callback, m_requestTime);
 
     return true;
 }
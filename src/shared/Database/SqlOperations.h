@@ -21,11 +21,13 @@
 
 #include "Common.h"
 #include "Utilities/Callback.h"
+#include "Util/Timer.h"
 
 #include <queue>
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <condition_variable>
 
 /// ---- BASE ---
 
@@ -76,6 +78,9 @@ class SqlPreparedRequest : public SqlOperation
 
         bool Execute(SqlConnection* conn) override;
 
+        int GetIndex() const { return m_nIndex; }
+        SqlStmtParameters const& GetParams() const { return *m_param; }
+
     private:
         const int m_nIndex;
         SqlStmtParameters* m_param;
@@ -88,15 +93,50 @@ class QueryResult;                                          /// the result of on
 class SqlQueryHolder;                                       /// groups several async quries
 class SqlQueryHolderEx;                                     /// points to a holder, added to the delay thread
 
+#define SQL_RESULT_LATENCY_BUCKETS 8
+
 class SqlResultQueue
 {
+    public:
+        // delivery latency of async results, from queuing the request until its callback runs
+        struct LatencyHistogram
+        {
+            LatencyHistogram() : samples(0), totalTime(0), maxTime(0) { memset(buckets, 0, sizeof(buckets)); }
+
+            static uint32 const BucketLimits[SQL_RESULT_LATENCY_BUCKETS - 1]; // upper bounds in ms, the last bucket has none
+
+            uint32 buckets[SQL_RESULT_LATENCY_BUCKETS];
+            uint32 samples;
+            uint64 totalTime;
+            uint32 maxTime;
+        };
+
     private:
+        struct Entry
+        {
+            Entry(MaNGOS::IQueryCallback* _callback, uint32 _requestTime) : callback(_callback), requestTime(_requestTime) {}
+
+            std::unique_ptr<MaNGOS::IQueryCallback> callback;
+            uint32 requestTime;
+        };
+
         std::mutex m_mutex;
-        std::queue<std::unique_ptr<MaNGOS::IQueryCallback>> m_queue;
+        std::queue<Entry> m_queue;
+        LatencyHistogram m_latency;                         // only touched by the thread calling Update
+
+        // shared by all result queues, the delivering thread waits on it between updates
+        static std::mutex m_signalMutex;
+        static std::condition_variable m_signal;
+        static bool m_signaled;
 
     public:
         void Update();
-        void Add(MaNGOS::IQueryCallback*);
+        void Add(MaNGOS::IQueryCallback* callback, uint32 requestTime);
+
+        LatencyHistogram const& GetLatencyHistogram() const { return m_latency; }
+
+        // waits up to timeMs for a result to be added to any queue, returns true if one was
+        static bool WaitForResults(uint32 timeMs);
 };
 
 class SqlQuery : public SqlOperation
@@ -105,10 +145,11 @@ class SqlQuery : public SqlOperation
         std::vector<char> m_sql;
         MaNGOS::IQueryCallback* const m_callback;
         SqlResultQueue* const m_queue;
+        uint32 const m_requestTime;
 
     public:
         SqlQuery(const char* sql, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue)
-            : m_sql(strlen(sql) + 1), m_callback(callback), m_queue(queue)
+            : m_sql(strlen(sql) + 1), m_callback(callback), m_queue(queue), m_requestTime(WorldTimer::getMSTime())
         {
             memcpy(&m_sql[0], sql, m_sql.size());
         }
@@ -139,9 +180,10 @@ class SqlQueryHolderEx : public SqlOperation
         SqlQueryHolder* m_holder;
         MaNGOS::IQueryCallback* m_callback;
         SqlResultQueue* m_queue;
+        uint32 m_requestTime;
     public:
         SqlQueryHolderEx(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue)
-            : m_holder(holder), m_callback(callback), m_queue(queue) {}
+            : m_holder(holder), m_callback(callback), m_queue(queue), m_requestTime(WorldTimer::getMSTime()) {}
         bool Execute(SqlConnection* conn) override;
 };
 #endif                                                      //__SQLOPERATIONS_H
@@ -18,6 +18,9 @@
 
 #include "DatabaseEnv.h"
 
+#include <iomanip>
+#include <limits>
+
 SqlStmtParameters::SqlStmtParameters(uint32 nParams)
 {
     // reserve memory if needed
@@ -146,8 +149,8 @@ void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::
         case FIELD_I16:     fmt << "'" << int32(data.toInt16()) << "'";     break;
         case FIELD_I32:     fmt << "'" << data.toInt32() << "'";            break;
         case FIELD_I64:     fmt << "'" << data.toInt64() << "'";            break;
-        case FIELD_FLOAT:   fmt << "'" << data.toFloat() << "'";            break;
-        case FIELD_DOUBLE:  fmt << "'" << data.toDouble() << "'";           break;
+        case FIELD_FLOAT:   fmt << "'" << std::setprecision(std::numeric_limits<float>::max_digits10) << data.toFloat() << "'";   break;
+        case FIELD_DOUBLE:  fmt << "'" << std::setprecision(std::numeric_limits<double>::max_digits10) << data.toDouble() << "'"; break;
         case FIELD_STRING:
         {
             std::string tmp = data.toStr();
@@ -155,6 +158,31 @@ void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::
             fmt << "'" << tmp << "'";
             break;
         }
+        case FIELD_BINARY:
+        {
+            std::string const& bin = data.toBinary();
+            if (bin.empty())
+            {
+                fmt << "''";
+                break;
+            }
+
+            // hex literal, the escaped string form would depend on the connection charset
+            static char const hexDigits[] = "0123456789ABCDEF";
+            std::string tmp;
+            tmp.reserve(bin.size() * 2);
+            for (std::string::const_iterator itr = bin.begin(); itr != bin.end(); ++itr)
+            {
+                tmp += hexDigits[uint8(*itr) >> 4];
+                tmp += hexDigits[uint8(*itr) & 0x0F];
+            }
+#ifdef DO_POSTGRESQL
+            fmt << "'\\x" << tmp << "'";
+#else
+            fmt << "X'" << tmp << "'";
+#endif
+            break;
+        }
         case FIELD_NONE:                                                    break;
         default: throw std::domain_error("Unrecognized sql data type");
     }
@@ -57,9 +57,18 @@ enum SqlStmtFieldType
     FIELD_FLOAT,
     FIELD_DOUBLE,
     FIELD_STRING,
+    FIELD_BINARY,
     FIELD_NONE
 };
 
+// raw bytes for BLOB columns, unlike strings they may contain zero bytes
+struct SqlStmtBinary
+{
+    explicit SqlStmtBinary(std::string const& _data) : data(_data) {}
+
+    std::string const& data;
+};
+
 // templates might be the best choice here
 // but I didn't have time to play with them
 class SqlStmtFieldData
@@ -87,11 +96,12 @@ class SqlStmtFieldData
         float toFloat() const { MANGOS_ASSERT(m_type == FIELD_FLOAT); return m_binaryData.f; }
         double toDouble() const { MANGOS_ASSERT(m_type == FIELD_DOUBLE); return m_binaryData.d; }
         const char* toStr() const { MANGOS_ASSERT(m_type == FIELD_STRING); return m_szStringData.c_str(); }
+        std::string const& toBinary() const { MANGOS_ASSERT(m_type == FIELD_BINARY); return m_szStringData; }
 
         // get type of data
         SqlStmtFieldType type() const { return m_type; }
         // get underlying buffer type
-        void* buff() const { return m_type == FIELD_STRING ? (void*)m_szStringData.c_str() : (void*)&m_binaryData; }
+        void* buff() const { return m_type == FIELD_STRING || m_type == FIELD_BINARY ? (void*)m_szStringData.data() : (void*)&m_binaryData; }
 
         // get size of data
         size_t size() const
@@ -111,6 +121,7 @@ class SqlStmtFieldData
                 case FIELD_FLOAT:   return sizeof(float);
                 case FIELD_DOUBLE:  return sizeof(double);
                 case FIELD_STRING:  return m_szStringData.length();
+                case FIELD_BINARY:  return m_szStringData.length();
 
                 default:
                     throw std::runtime_error("unrecognized type of SqlStmtFieldType obtained");
@@ -136,6 +147,7 @@ template<> inline void SqlStmtFieldData::set(int64 val) { m_type = FIELD_I64; m_
 template<> inline void SqlStmtFieldData::set(float val) { m_type = FIELD_FLOAT; m_binaryData.f = val; }
 template<> inline void SqlStmtFieldData::set(double val) { m_type = FIELD_DOUBLE; m_binaryData.d = val; }
 template<> inline void SqlStmtFieldData::set(const char* val) { m_type = FIELD_STRING; m_szStringData = val; }
+template<> inline void SqlStmtFieldData::set(SqlStmtBinary val) { m_type = FIELD_BINARY; m_szStringData = val.data; }
 
 class SqlStatement;
 // prepared statement executor
@@ -257,6 +269,7 @@ class SqlStatement
         void addString(const char* var) { arg(var); }
         void addString(const std::string& var) { arg(var.c_str()); }
         void addString(std::ostringstream& ss) { arg(ss.str().c_str()); ss.str(std::string()); }
+        void addBinary(const std::string& var) { arg(SqlStmtBinary(var)); }
 
     protected:
         // don't allow anyone except Database class to create static SqlStatement objects
@@ -344,6 +357,9 @@ class SqlPlainPreparedStatement : public SqlPreparedStatement
 
         virtual bool execute() override;
 
+        // request text produced by the last bind()
+        std::string const& GetPlainRequest() const { return m_szPlainRequest; }
+
     protected:
         void DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const;
 
@@ -28,6 +28,8 @@
 #include <iostream>
 #include <thread>
 #include <cstdarg>
+#include <cstring>
+#include <algorithm>
 
 #include <boost/stacktrace.hpp>
 
@@ -73,7 +75,8 @@ Log::Log() :
 #ifdef BUILD_ELUNA
     elunaErrLogfile(nullptr),
 #endif
-    eventAiErLogfile(nullptr), scriptErrLogFile(nullptr), worldLogfile(nullptr), customLogFile(nullptr), m_colored(false), m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(nullptr)
+    eventAiErLogfile(nullptr), scriptErrLogFile(nullptr), worldLogfile(nullptr), customLogFile(nullptr),
+    m_fileQueueLimit(0), m_fileQueueDropped(0), m_fileWriterStop(false), m_fileWriterBusy(false), m_colored(false), m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(nullptr)
 {
     Initialize();
 }
@@ -223,6 +226,9 @@ void Log::SetLogFileLevel(char* level)
 
 void Log::Initialize()
 {
+    // files are reopened below, nothing may be queued for the old ones
+    StopFileWriter();
+
     /// Common log files data
     m_logsDir = sConfig.GetStringDefault("LogsDir");
     if (!m_logsDir.empty())
@@ -293,6 +299,10 @@ void Log::Initialize()
 
     // Char log settings
     m_charLog_Dump = sConfig.GetBoolDefault("CharLogDump", false);
+
+    m_fileQueueLimit = sConfig.GetIntDefault("LogFileAsyncQueueSize", 100000);
+    if (sConfig.GetBoolDefault("LogFileAsync", true))
+        StartFileWriter();
 }
 
 FILE* Log::openLogFile(char const* configFileName, char const* configTimeStampFlag, char const* mode)
@@ -313,19 +323,23 @@ FILE* Log::openLogFile(char const* configFileName, char const* configTimeStampFl
     return fopen((m_logsDir + logfn).c_str(), mode);
 }
 
-FILE* Log::openGmlogPerAccount(uint32 account)
+std::string Log::getGmlogPerAccountFileName(uint32 account) const
 {
     if (m_gmlog_filename_format.empty())
-        return nullptr;
+        return std::string();
 
     char namebuf[MANGOS_PATH_MAX];
     snprintf(namebuf, MANGOS_PATH_MAX, m_gmlog_filename_format.c_str(), account);
-    return fopen(namebuf, "a");
+    return namebuf;
 }
 
 void Log::outTimestamp(FILE* file)
 {
-    time_t t = time(nullptr);
+    outTimestamp(file, time(nullptr));
+}
+
+void Log::outTimestamp(FILE* file, time_t t)
+{
     tm* aTm = localtime(&t);
     //       YYYY   year
     //       MM     month (2 digits 01-12)
@@ -368,18 +382,16 @@ std::string Log::GetTimestampStr()
 
 void Log::outString()
 {
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
-    if (m_includeTime)
-        outTime();
-    printf("\n");
-    if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "\n");
-        fflush(logfile);
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+        if (m_includeTime)
+            outTime();
+        printf("\n");
+        fflush(stdout);
     }
 
-    fflush(stdout);
+    if (logfile)
+        outFile(logfile, "\n");
 }
 
 void Log::outString(const char* str, ...)
@@ -387,38 +399,34 @@ void Log::outString(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
 
-    if (m_colored)
-        SetColor(true, m_colors[LogNormal]);
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
-    if (m_includeTime)
-        outTime();
+        if (m_colored)
+            SetColor(true, m_colors[LogNormal]);
 
-    va_list ap;
+        if (m_includeTime)
+            outTime();
 
-    va_start(ap, str);
-    vutf8printf(stdout, str, &ap);
-    va_end(ap);
+        va_start(ap, str);
+        vutf8printf(stdout, str, &ap);
+        va_end(ap);
 
-    if (m_colored)
-        ResetColor(true);
+        if (m_colored)
+            ResetColor(true);
 
-    printf("\n");
+        printf("\n");
+        fflush(stdout);
+    }
 
     if (logfile)
     {
-        outTimestamp(logfile);
-
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
-        fprintf(logfile, "\n");
+        outFile(logfile, nullptr, str, ap);
         va_end(ap);
-
-        fflush(logfile);
     }
-
-    fflush(stdout);
 }
 
 void Log::outError(const char* err, ...)
@@ -426,64 +434,53 @@ void Log::outError(const char* err, ...)
     if (!err)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
 
-    if (m_colored)
-        SetColor(false, m_colors[LogError]);
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
-    if (m_includeTime)
-        outTime();
+        if (m_colored)
+            SetColor(false, m_colors[LogError]);
 
-    va_list ap;
+        if (m_includeTime)
+            outTime();
 
-    va_start(ap, err);
-    vutf8printf(stderr, err, &ap);
-    va_end(ap);
+        va_start(ap, err);
+        vutf8printf(stderr, err, &ap);
+        va_end(ap);
 
-    if (m_colored)
-        ResetColor(false);
+        if (m_colored)
+            ResetColor(false);
+
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
-    fprintf(stderr, "\n");
     if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR:");
-
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, "ERROR:", err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
-
-    fflush(stderr);
 }
 
 void Log::outErrorDb()
 {
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
-    if (m_includeTime)
-        outTime();
+        if (m_includeTime)
+            outTime();
 
-    fprintf(stderr, "\n");
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
     if (logfile)
-    {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR:\n");
-        fflush(logfile);
-    }
+        outFile(logfile, "ERROR:\n");
 
     if (dberLogfile)
-    {
-        outTimestamp(dberLogfile);
-        fprintf(dberLogfile, "\n");
-        fflush(dberLogfile);
-    }
-
-    fflush(stderr);
+        outFile(dberLogfile, "\n");
 }
 
 void Log::outErrorDb(const char* err, ...)
@@ -491,52 +488,41 @@ void Log::outErrorDb(const char* err, ...)
     if (!err)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
 
-    if (m_colored)
-        SetColor(false, m_colors[LogError]);
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
-    if (m_includeTime)
-        outTime();
+        if (m_colored)
+            SetColor(false, m_colors[LogError]);
 
-    va_list ap;
+        if (m_includeTime)
+            outTime();
 
-    va_start(ap, err);
-    vutf8printf(stderr, err, &ap);
-    va_end(ap);
+        va_start(ap, err);
+        vutf8printf(stderr, err, &ap);
+        va_end(ap);
 
-    if (m_colored)
-        ResetColor(false);
+        if (m_colored)
+            ResetColor(false);
 
-    fprintf(stderr, "\n");
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
     if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR:");
-
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, "ERROR:", err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
 
     if (dberLogfile)
     {
-        outTimestamp(dberLogfile);
-
-        va_list ap;
         va_start(ap, err);
-        vfprintf(dberLogfile, err, ap);
+        outFile(dberLogfile, nullptr, err, ap);
         va_end(ap);
-
-        fprintf(dberLogfile, "\n");
-        fflush(dberLogfile);
     }
-
-    fflush(stderr);
 }
 
 void Log::outErrorEluna()
@@ -545,22 +531,13 @@ void Log::outErrorEluna()
         outTime();
 
     fprintf(stderr, "\n");
+    fflush(stderr);
 
     if (logfile)
-    {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR Eluna\n");
-        fflush(logfile);
-    }
+        outFile(logfile, "ERROR Eluna\n");
 
     if (elunaErrLogfile)
-    {
-        outTimestamp(elunaErrLogfile);
-        fprintf(elunaErrLogfile, "\n");
-        fflush(elunaErrLogfile);
-    }
-
-    fflush(stderr);
+        outFile(elunaErrLogfile, "\n");
 }
 
 void Log::outErrorEluna(const char* err, ...)
@@ -584,60 +561,40 @@ void Log::outErrorEluna(const char* err, ...)
         ResetColor(false);
 
     fprintf(stderr, "\n");
+    fflush(stderr);
 
     if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR Eluna: ");
-
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, "ERROR Eluna: ", err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
 
     if (elunaErrLogfile)
     {
-        outTimestamp(elunaErrLogfile);
-
-        va_list ap;
         va_start(ap, err);
-        vfprintf(elunaErrLogfile, err, ap);
+        outFile(elunaErrLogfile, nullptr, err, ap);
         va_end(ap);
-
-        fprintf(elunaErrLogfile, "\n");
-        fflush(elunaErrLogfile);
     }
-
-    fflush(stderr);
 }
 
 void Log::outErrorEventAI()
 {
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
-    if (m_includeTime)
-        outTime();
+        if (m_includeTime)
+            outTime();
 
-    fprintf(stderr, "\n");
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
     if (logfile)
-    {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR CreatureEventAI\n");
-        fflush(logfile);
-    }
+        outFile(logfile, "ERROR CreatureEventAI\n");
 
     if (eventAiErLogfile)
-    {
-        outTimestamp(eventAiErLogfile);
-        fprintf(eventAiErLogfile, "\n");
-        fflush(eventAiErLogfile);
-    }
-
-    fflush(stderr);
+        outFile(eventAiErLogfile, "\n");
 }
 
 void Log::outErrorEventAI(const char* err, ...)
@@ -645,51 +602,40 @@ void Log::outErrorEventAI(const char* err, ...)
     if (!err)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
-    if (m_colored)
-        SetColor(false, m_colors[LogError]);
+    va_list ap;
 
-    if (m_includeTime)
-        outTime();
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+        if (m_colored)
+            SetColor(false, m_colors[LogError]);
 
-    va_list ap;
+        if (m_includeTime)
+            outTime();
 
-    va_start(ap, err);
-    vutf8printf(stderr, err, &ap);
-    va_end(ap);
+        va_start(ap, err);
+        vutf8printf(stderr, err, &ap);
+        va_end(ap);
 
-    if (m_colored)
-        ResetColor(false);
+        if (m_colored)
+            ResetColor(false);
 
-    fprintf(stderr, "\n");
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
     if (logfile)
     {
-        outTimestamp(logfile);
-        fprintf(logfile, "ERROR CreatureEventAI: ");
-
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, "ERROR CreatureEventAI: ", err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
 
     if (eventAiErLogfile)
     {
-        outTimestamp(eventAiErLogfile);
-
-        va_list ap;
         va_start(ap, err);
-        vfprintf(eventAiErLogfile, err, ap);
+        outFile(eventAiErLogfile, nullptr, err, ap);
         va_end(ap);
-
-        fprintf(eventAiErLogfile, "\n");
-        fflush(eventAiErLogfile);
     }
-
-    fflush(stderr);
 }
 
 void Log::outBasic(const char* str, ...)
@@ -697,16 +643,18 @@ void Log::outBasic(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
+
     if (m_logLevel >= LOG_LVL_BASIC)
     {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+
         if (m_colored)
             SetColor(true, m_colors[LogDetails]);
 
         if (m_includeTime)
             outTime();
 
-        va_list ap;
         va_start(ap, str);
         vutf8printf(stdout, str, &ap);
         va_end(ap);
@@ -715,20 +663,15 @@ void Log::outBasic(const char* str, ...)
             ResetColor(true);
 
         printf("\n");
+        fflush(stdout);
     }
 
     if (logfile && m_logFileLevel >= LOG_LVL_BASIC)
     {
-        va_list ap;
-        outTimestamp(logfile);
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
-        fprintf(logfile, "\n");
+        outFile(logfile, nullptr, str, ap);
         va_end(ap);
-        fflush(logfile);
     }
-
-    fflush(stdout);
 }
 
 void Log::outDetail(const char* str, ...)
@@ -736,16 +679,18 @@ void Log::outDetail(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
+
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+
         if (m_colored)
             SetColor(true, m_colors[LogDetails]);
 
         if (m_includeTime)
             outTime();
 
-        va_list ap;
         va_start(ap, str);
         vutf8printf(stdout, str, &ap);
         va_end(ap);
@@ -754,22 +699,15 @@ void Log::outDetail(const char* str, ...)
             ResetColor(true);
 
         printf("\n");
+        fflush(stdout);
     }
 
     if (logfile && m_logFileLevel >= LOG_LVL_DETAIL)
     {
-        outTimestamp(logfile);
-
-        va_list ap;
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
+        outFile(logfile, nullptr, str, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
-
-    fflush(stdout);
 }
 
 void Log::outDebug(const char* str, ...)
@@ -777,16 +715,18 @@ void Log::outDebug(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
+
     if (m_logLevel >= LOG_LVL_DEBUG)
     {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+
         if (m_colored)
             SetColor(true, m_colors[LogDebug]);
 
         if (m_includeTime)
             outTime();
 
-        va_list ap;
         va_start(ap, str);
         vutf8printf(stdout, str, &ap);
         va_end(ap);
@@ -795,22 +735,15 @@ void Log::outDebug(const char* str, ...)
             ResetColor(true);
 
         printf("\n");
+        fflush(stdout);
     }
 
     if (logfile && m_logFileLevel >= LOG_LVL_DEBUG)
     {
-        outTimestamp(logfile);
-
-        va_list ap;
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
+        outFile(logfile, nullptr, str, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
-
-    fflush(stdout);
 }
 
 void Log::outCommand(uint32 account, const char* str, ...)
@@ -818,16 +751,18 @@ void Log::outCommand(uint32 account, const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    va_list ap;
+
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+
         if (m_colored)
             SetColor(true, m_colors[LogDetails]);
 
         if (m_includeTime)
             outTime();
 
-        va_list ap;
         va_start(ap, str);
         vutf8printf(stdout, str, &ap);
         va_end(ap);
@@ -836,44 +771,37 @@ void Log::outCommand(uint32 account, const char* str, ...)
             ResetColor(true);
 
         printf("\n");
+        fflush(stdout);
     }
 
     if (logfile && m_logFileLevel >= LOG_LVL_DETAIL)
     {
-        va_list ap;
-        outTimestamp(logfile);
         va_start(ap, str);
-        vfprintf(logfile, str, ap);
-        fprintf(logfile, "\n");
+        outFile(logfile, nullptr, str, ap);
         va_end(ap);
-        fflush(logfile);
     }
 
     if (m_gmlog_per_account)
     {
-        if (FILE* per_file = openGmlogPerAccount(account))
+        std::string filename = getGmlogPerAccountFileName(account);
+        if (!filename.empty())
         {
-            va_list ap;
-            outTimestamp(per_file);
+            FileRecord record;
+            record.path = std::move(filename);              // opened and closed by the writer
+            record.time = time(nullptr);
             va_start(ap, str);
-            vfprintf(per_file, str, ap);
-            fprintf(per_file, "\n");
+            appendFormatted(record.text, str, ap);
             va_end(ap);
-            fclose(per_file);
+            record.text += '\n';
+            QueueFileRecord(std::move(record));
         }
     }
     else if (gmLogfile)
     {
-        va_list ap;
-        outTimestamp(gmLogfile);
         va_start(ap, str);
-        vfprintf(gmLogfile, str, ap);
-        fprintf(gmLogfile, "\n");
+        outFile(gmLogfile, nullptr, str, ap);
         va_end(ap);
-        fflush(gmLogfile);
     }
-
-    fflush(stdout);
 }
 
 void Log::outChar(const char* str, ...)
@@ -881,45 +809,36 @@ void Log::outChar(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (charLogfile)
     {
         va_list ap;
-        outTimestamp(charLogfile);
         va_start(ap, str);
-        vfprintf(charLogfile, str, ap);
-        fprintf(charLogfile, "\n");
+        outFile(charLogfile, nullptr, str, ap);
         va_end(ap);
-        fflush(charLogfile);
     }
 }
 
 void Log::outErrorScriptLib()
 {
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
-    if (m_includeTime)
-        outTime();
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+        if (m_includeTime)
+            outTime();
 
-    fprintf(stderr, "\n");
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
     if (logfile)
     {
-        outTimestamp(logfile);
         if (m_scriptLibName)
-            fprintf(logfile, "<%s ERROR:> ", m_scriptLibName);
+            outFile(logfile, std::string("<") + m_scriptLibName + " ERROR:> ");
         else
-            fprintf(logfile, "<Scripting Library ERROR>: ");
-        fflush(logfile);
+            outFile(logfile, "<Scripting Library ERROR>: ");
     }
 
     if (scriptErrLogFile)
-    {
-        outTimestamp(scriptErrLogFile);
-        fprintf(scriptErrLogFile, "\n");
-        fflush(scriptErrLogFile);
-    }
-
-    fflush(stderr);
+        outFile(scriptErrLogFile, "\n");
 }
 
 void Log::outErrorScriptLib(const char* err, ...)
@@ -927,54 +846,42 @@ void Log::outErrorScriptLib(const char* err, ...)
     if (!err)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
-    if (m_colored)
-        SetColor(false, m_colors[LogError]);
+    va_list ap;
 
-    if (m_includeTime)
-        outTime();
+    {
+        std::lock_guard<std::mutex> guard(m_worldLogMtx);
+        if (m_colored)
+            SetColor(false, m_colors[LogError]);
 
-    va_list ap;
+        if (m_includeTime)
+            outTime();
 
-    va_start(ap, err);
-    vutf8printf(stderr, err, &ap);
-    va_end(ap);
+        va_start(ap, err);
+        vutf8printf(stderr, err, &ap);
+        va_end(ap);
 
-    if (m_colored)
-        ResetColor(false);
+        if (m_colored)
+            ResetColor(false);
 
-    fprintf(stderr, "\n");
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
 
     if (logfile)
     {
-        outTimestamp(logfile);
-        if (m_scriptLibName)
-            fprintf(logfile, "<%s ERROR>: ", m_scriptLibName);
-        else
-            fprintf(logfile, "<Scripting Library ERROR>: ");
+        std::string prefix = m_scriptLibName ? std::string("<") + m_scriptLibName + " ERROR>: " : "<Scripting Library ERROR>: ";
 
         va_start(ap, err);
-        vfprintf(logfile, err, ap);
+        outFile(logfile, prefix.c_str(), err, ap);
         va_end(ap);
-
-        fprintf(logfile, "\n");
-        fflush(logfile);
     }
 
     if (scriptErrLogFile)
     {
-        outTimestamp(scriptErrLogFile);
-
-        va_list ap;
         va_start(ap, err);
-        vfprintf(scriptErrLogFile, err, ap);
+        outFile(scriptErrLogFile, nullptr, err, ap);
         va_end(ap);
-
-        fprintf(scriptErrLogFile, "\n");
-        fflush(scriptErrLogFile);
     }
-
-    fflush(stderr);
 }
 
 void Log::outWorldPacketDump(const char* socket, uint32 opcode, char const* opcodeName, ByteBuffer const& packet, bool incoming)
@@ -982,35 +889,33 @@ void Log::outWorldPacketDump(const char* socket, uint32 opcode, char const* opco
     if (!worldLogfile)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
-
-    outTimestamp(worldLogfile);
-
-    fprintf(worldLogfile, "\n%s:\nSOCKET: %s\nLENGTH: %u\nOPCODE: %s (0x%.4X)\nDATA:\n",
-            incoming ? "CLIENT" : "SERVER",
-            socket, static_cast<uint32>(packet.size()), opcodeName, opcode);
-
-    size_t p = 0;
-    while (p < packet.size())
-    {
-        for (size_t j = 0; j < 16 && p < packet.size(); ++j)
-            fprintf(worldLogfile, "%.2X ", packet[p++]);
-
-        fprintf(worldLogfile, "\n");
-    }
-
-    fprintf(worldLogfile, "\n\n");
-    fflush(worldLogfile);
+    // only the raw bytes are copied here, the hex dump is formatted by the writer
+    FileRecord record;
+    record.file = worldLogfile;
+    record.time = time(nullptr);
+    record.packet = true;
+    record.text = socket;
+    record.opcode = opcode;
+    record.opcodeName = opcodeName;
+    record.incoming = incoming;
+    if (packet.size())
+        record.data.assign(packet.contents(), packet.contents() + packet.size());
+
+    QueueFileRecord(std::move(record));
 }
 
 void Log::outCharDump(const char* str, uint32 account_id, uint32 guid, const char* name)
 {
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
-
     if (charLogfile)
     {
-        fprintf(charLogfile, "== START DUMP == (account: %u guid: %u name: %s )\n%s\n== END DUMP ==\n", account_id, guid, name, str);
-        fflush(charLogfile);
+        FileRecord record;
+        record.file = charLogfile;
+        record.timestamp = false;
+        char header[256];
+        snprintf(header, sizeof(header), "== START DUMP == (account: %u guid: %u name: %s )\n", account_id, guid, name);
+        record.text.reserve(strlen(header) + strlen(str) + 16);
+        record.text.append(header).append(str).append("\n== END DUMP ==\n");
+        QueueFileRecord(std::move(record));
     }
 }
 
@@ -1019,19 +924,13 @@ void Log::outRALog(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (raLogfile)
     {
         va_list ap;
-        outTimestamp(raLogfile);
         va_start(ap, str);
-        vfprintf(raLogfile, str, ap);
-        fprintf(raLogfile, "\n");
+        outFile(raLogfile, nullptr, str, ap);
         va_end(ap);
-        fflush(raLogfile);
     }
-
-    fflush(stdout);
 }
 
 void Log::outCustomLog(const char* str, ...)
@@ -1039,19 +938,213 @@ void Log::outCustomLog(const char* str, ...)
     if (!str)
         return;
 
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (customLogFile)
     {
         va_list ap;
-        outTimestamp(customLogFile);
         va_start(ap, str);
-        vfprintf(customLogFile, str, ap);
-        fprintf(customLogFile, "\n");
+        outFile(customLogFile, nullptr, str, ap);
         va_end(ap);
-        fflush(customLogFile);
     }
+}
+
+void Log::appendFormatted(std::string& out, char const* format, va_list ap)
+{
+    char buf[1024];
+
+    va_list apCopy;
+    va_copy(apCopy, ap);
+    int len = vsnprintf(buf, sizeof(buf), format, apCopy);
+    va_end(apCopy);
+
+    if (len < 0)
+        return;
 
-    fflush(stdout);
+    if (size_t(len) < sizeof(buf))
+    {
+        out.append(buf, len);
+        return;
+    }
+
+    size_t pos = out.size();
+    out.resize(pos + len + 1);
+    vsnprintf(&out[pos], len + 1, format, ap);
+    out.resize(pos + len);
+}
+
+void Log::outFile(FILE* file, char const* prefix, char const* format, va_list ap)
+{
+    FileRecord record;
+    record.file = file;
+    record.time = time(nullptr);
+    if (prefix)
+        record.text = prefix;
+    appendFormatted(record.text, format, ap);
+    record.text += '\n';
+
+    QueueFileRecord(std::move(record));
+}
+
+void Log::outFile(FILE* file, std::string const& text)
+{
+    FileRecord record;
+    record.file = file;
+    record.time = time(nullptr);
+    record.text = text;
+
+    QueueFileRecord(std::move(record));
+}
+
+void Log::QueueFileRecord(FileRecord&& record)
+{
+    std::lock_guard<std::mutex> guard(m_fileQueueLock);
+
+    // synchronous mode (LogFileAsync = 0 or writer not started yet)
+    if (!m_fileWriter.joinable())
+    {
+        if (FILE* file = WriteFileRecord(record))
+            fflush(file);
+        return;
+    }
+
+    // disk I/O can't keep up, drop the record instead of stalling the logging thread or growing without bound
+    if (m_fileQueueLimit && m_fileQueue.size() >= m_fileQueueLimit)
+    {
+        ++m_fileQueueDropped;
+        return;
+    }
+
+    m_fileQueue.push_back(std::move(record));
+    m_fileQueueCondition.notify_one();
+}
+
+FILE* Log::WriteFileRecord(FileRecord& record)
+{
+    FILE* file = record.file;
+    if (!file)
+    {
+        if (record.path.empty())
+            return nullptr;
+
+        file = fopen(record.path.c_str(), "a");
+        if (!file)
+            return nullptr;
+    }
+
+    if (record.timestamp)
+        outTimestamp(file, record.time);
+
+    if (record.packet)
+    {
+        fprintf(file, "\n%s:\nSOCKET: %s\nLENGTH: %u\nOPCODE: %s (0x%.4X)\nDATA:\n",
+                record.incoming ? "CLIENT" : "SERVER",
+                record.text.c_str(), static_cast<uint32>(record.data.size()), record.opcodeName, record.opcode);
+
+        // one fwrite per 16 bytes row
+        static char const hex[] = "0123456789ABCDEF";
+        char line[16 * 3 + 1];
+        size_t p = 0;
+        while (p < record.data.size())
+        {
+            size_t len = 0;
+            for (size_t j = 0; j < 16 && p < record.data.size(); ++j, ++p)
+            {
+                line[len++] = hex[record.data[p] >> 4];
+                line[len++] = hex[record.data[p] & 0x0F];
+                line[len++] = ' ';
+            }
+            line[len++] = '\n';
+            fwrite(line, 1, len, file);
+        }
+
+        fputs("\n\n", file);
+    }
+    else
+        fwrite(record.text.data(), 1, record.text.size(), file);
+
+    if (!record.file)
+    {
+        fclose(file);
+        return nullptr;
+    }
+
+    return file;
+}
+
+void Log::StartFileWriter()
+{
+    if (m_fileWriter.joinable())
+        return;
+
+    m_fileWriterStop = false;
+    m_fileWriter = std::thread(&Log::FileWriterThread, this);
+}
+
+void Log::StopFileWriter()
+{
+    if (!m_fileWriter.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(m_fileQueueLock);
+        m_fileWriterStop = true;
+    }
+    m_fileQueueCondition.notify_one();
+
+    m_fileWriter.join();                                    // writer leaves only with empty queue
+}
+
+void Log::WaitFileWriter()
+{
+    std::unique_lock<std::mutex> lock(m_fileQueueLock);
+    m_fileQueueDrained.wait(lock, [this] { return !m_fileWriter.joinable() || (m_fileQueue.empty() && !m_fileWriterBusy); });
+}
+
+void Log::FileWriterThread()
+{
+    std::vector<FileRecord> batch;
+    std::vector<FILE*> written;
+    uint32 dropped = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_fileQueueLock);
+
+            m_fileWriterBusy = false;
+            m_fileQueueDrained.notify_all();
+
+            m_fileQueueCondition.wait(lock, [this] { return !m_fileQueue.empty() || m_fileWriterStop; });
+            if (m_fileQueue.empty())
+                return;                                     // stop requested and all records written
+
+            batch.swap(m_fileQueue);
+            dropped = m_fileQueueDropped;
+            m_fileQueueDropped = 0;
+            m_fileWriterBusy = true;
+        }
+
+        // note the gap in the server log, after the records queued before it
+        if (dropped && logfile)
+        {
+            FileRecord record;
+            record.file = logfile;
+            record.time = time(nullptr);
+            record.text = "Log writer could not keep up, " + std::to_string(dropped) + " log records dropped (LogFileAsyncQueueSize)\n";
+            batch.push_back(std::move(record));
+        }
+
+        for (FileRecord& record : batch)
+            if (FILE* file = WriteFileRecord(record))
+                if (std::find(written.begin(), written.end(), file) == written.end())
+                    written.push_back(file);
+
+        // one flush per file and batch instead of one per line
+        for (FILE* file : written)
+            fflush(file);
+
+        batch.clear();
+        written.clear();
+    }
 }
 
 void Log::WaitBeforeContinueIfNeed()
@@ -1079,6 +1172,8 @@ void Log::WaitBeforeContinueIfNeed()
 
 void Log::setScriptLibraryErrorFile(char const* fname, char const* libName)
 {
+    WaitFileWriter();                                       // queued records may still use the old file
+
     m_scriptLibName = libName;
 
     if (scriptErrLogFile)
@@ -1191,14 +1286,14 @@ void script_error_log(const char* str, ...)
 
 void Log::traceLog()
 {
-    std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (customLogFile)
     {
-        fprintf(customLogFile, "%s\n", GetTraceLog().data());
-        fflush(customLogFile);
+        FileRecord record;
+        record.file = customLogFile;
+        record.timestamp = false;
+        record.text = GetTraceLog() + "\n";
+        QueueFileRecord(std::move(record));
     }
-
-    fflush(stdout);
 }
 
 // has to be in a locked enviroment on linux
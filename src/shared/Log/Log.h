@@ -23,6 +23,10 @@
 #include "Policies/Singleton.h"
 
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <cstdarg>
 
 class Config;
 class ByteBuffer;
@@ -100,6 +104,8 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
 
         ~Log()
         {
+            StopFileWriter();
+
             if (logfile != nullptr)
                 fclose(logfile);
             logfile = nullptr;
@@ -187,6 +193,7 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
         void ResetColor(bool stdout_stream);
         void outTime() const;
         static void outTimestamp(FILE* file);
+        static void outTimestamp(FILE* file, time_t t);
         static std::string GetTimestampStr();
         bool HasLogFilter(uint32 filter) const { return (m_logFilter & filter) != 0; }
         void SetLogFilter(LogFilters filter, bool on) { if (on) m_logFilter |= filter; else m_logFilter &= ~filter; }
@@ -204,7 +211,33 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
 
     private:
         FILE* openLogFile(char const* configFileName, char const* configTimeStampFlag, char const* mode);
-        FILE* openGmlogPerAccount(uint32 account);
+        std::string getGmlogPerAccountFileName(uint32 account) const;
+
+        // File output is queued and written by a background thread in batches, so callers
+        // only pay for formatting their line. Console output stays synchronous.
+        struct FileRecord
+        {
+            FILE* file = nullptr;                           // target, or nullptr to append to path
+            std::string path;                               // gm log per account, opened and closed per record
+            time_t time = 0;
+            bool timestamp = true;
+            std::string text;                               // line text, socket name for packet dumps
+            bool packet = false;                            // data is hex dumped by the writer
+            uint32 opcode = 0;
+            char const* opcodeName = nullptr;
+            bool incoming = false;
+            std::vector<uint8> data;
+        };
+
+        static void appendFormatted(std::string& out, char const* format, va_list ap);
+        void outFile(FILE* file, char const* prefix, char const* format, va_list ap);
+        void outFile(FILE* file, std::string const& text);
+        void QueueFileRecord(FileRecord&& record);
+        static FILE* WriteFileRecord(FileRecord& record);
+        void StartFileWriter();
+        void StopFileWriter();
+        void WaitFileWriter();
+        void FileWriterThread();
 
         FILE* raLogfile;
         FILE* logfile;
@@ -220,6 +253,16 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
         std::mutex m_worldLogMtx;
         std::mutex m_traceLogMtx;
 
+        std::mutex m_fileQueueLock;
+        std::condition_variable m_fileQueueCondition;   // wakes the writer
+        std::condition_variable m_fileQueueDrained;     // signalled when the writer is idle
+        std::vector<FileRecord> m_fileQueue;
+        uint32 m_fileQueueLimit;                        // records queued at most, 0 = unlimited
+        uint32 m_fileQueueDropped;                      // records dropped since the writer last reported
+        std::thread m_fileWriter;
+        bool m_fileWriterStop;
+        bool m_fileWriterBusy;
+
         // log/console control
         LogLevel m_logLevel;
         LogLevel m_logFileLevel;
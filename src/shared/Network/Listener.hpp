@@ -20,9 +20,11 @@
 #define __LISTENER_HPP_
 
 #include "NetworkThread.hpp"
+#include "Log/Log.h"
 
 #include <boost/asio.hpp>
 
+#include <future>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -39,21 +41,25 @@ namespace MaNGOS
             std::thread m_acceptorThread;
             std::vector<std::unique_ptr<NetworkThread<SocketType>>> m_workerThreads;
 
+            // sharded mode: every network thread accepts on its own SO_REUSEPORT acceptor and the kernel spreads
+            // the connections.  declared after the workers, an acceptor must be destroyed before its io_context
+            std::vector<std::unique_ptr<boost::asio::ip::tcp::acceptor>> m_shardAcceptors;
+
             // the time in milliseconds to sleep a worker thread at the end of each tick
             const int SleepInterval = 100;
 
             NetworkThread<SocketType> *SelectWorker() const
             {
                 int minIndex = 0;
-                size_t minSize = m_workerThreads[minIndex]->Size();
+                uint64 minLoad = m_workerThreads[minIndex]->GetLoad();
 
                 for (size_t i = 1; i < m_workerThreads.size(); ++i)
                 {
-                    const size_t size = m_workerThreads[i]->Size();
+                    const uint64 load = m_workerThreads[i]->GetLoad();
 
-                    if (size < minSize)
+                    if (load < minLoad)
                     {
-                        minSize = size;
+                        minLoad = load;
                         minIndex = i;
                     }
                 }
@@ -61,22 +67,50 @@ namespace MaNGOS
                 return m_workerThreads[minIndex].get();
             }
 
+            bool OpenShardAcceptors(boost::asio::ip::tcp::endpoint const& endpoint);
+
             void BeginAccept();
             void OnAccept(NetworkThread<SocketType> *worker, std::shared_ptr<SocketType> const& socket, const boost::system::error_code &ec);
 
+            void BeginShardAccept(size_t shard);
+            void OnShardAccept(size_t shard, std::shared_ptr<SocketType> const& socket, const boost::system::error_code &ec);
+
+            // run the function on the given io_context and wait for it
+            static void RunOn(boost::asio::io_context& context, std::function<void()> function)
+            {
+                std::promise<void> done;
+                boost::asio::post(context, [&]() { function(); done.set_value(); });
+                done.get_future().wait();
+            }
+
         public:
-            Listener(std::string const& address, int port, int workerThreads);
+            Listener(std::string const& address, int port, int workerThreads, bool reusePort = false);
             ~Listener();
     };
 
     template <typename SocketType>
-    Listener<SocketType>::Listener(std::string const& address, int port, int workerThreads)
-    : m_context(), m_acceptor(m_context, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address(address), port))
+    Listener<SocketType>::Listener(std::string const& address, int port, int workerThreads, bool reusePort)
+    : m_context(), m_acceptor(m_context)
     {
         m_workerThreads.reserve(workerThreads);
         for (auto i = 0; i < workerThreads; ++i)
             m_workerThreads.push_back(std::unique_ptr<NetworkThread<SocketType>>(new NetworkThread<SocketType>));
 
+        boost::asio::ip::tcp::endpoint const endpoint(boost::asio::ip::make_address(address), port);
+
+        if (reusePort && OpenShardAcceptors(endpoint))
+        {
+            for (size_t i = 0; i < m_shardAcceptors.size(); ++i)
+                boost::asio::post(m_workerThreads[i]->GetContext(), [this, i]() { BeginShardAccept(i); });
+
+            return;
+        }
+
+        m_acceptor.open(endpoint.protocol());
+        m_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+        m_acceptor.bind(endpoint);
+        m_acceptor.listen();
+
         BeginAccept();
 
         m_acceptorThread = std::thread([this]() { m_context.run(); });
@@ -89,8 +123,45 @@ namespace MaNGOS
         // operation and should stop the acceptor thread. Note that closing
         // the acceptor needs to be done in the acceptor thread, because
         // using the m_acceptor object from multiple threads is unsafe!
-        boost::asio::post(m_context, [this]() { m_acceptor.close(); });
-        m_acceptorThread.join();
+        if (m_acceptorThread.joinable())
+        {
+            boost::asio::post(m_context, [this]() { m_acceptor.close(); });
+            m_acceptorThread.join();
+        }
+
+        // same for the shard acceptors, on their network threads.  the second run waits
+        // for the cancelled accept handlers queued by close()
+        for (size_t i = 0; i < m_shardAcceptors.size(); ++i)
+        {
+            RunOn(m_workerThreads[i]->GetContext(), [this, i]() { m_shardAcceptors[i]->close(); });
+            RunOn(m_workerThreads[i]->GetContext(), []() {});
+        }
+    }
+
+    template <typename SocketType>
+    bool Listener<SocketType>::OpenShardAcceptors(boost::asio::ip::tcp::endpoint const& endpoint)
+    {
+#ifdef SO_REUSEPORT
+        typedef boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+
+        for (auto const& worker : m_workerThreads)
+        {
+            std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor(new boost::asio::ip::tcp::acceptor(worker->GetContext()));
+
+            acceptor->open(endpoint.protocol());
+            acceptor->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+            acceptor->set_option(reuse_port(true));
+            acceptor->bind(endpoint);
+            acceptor->listen();
+
+            m_shardAcceptors.push_back(std::move(acceptor));
+        }
+
+        return true;
+#else
+        sLog.outError("Listener: SO_REUSEPORT is not supported on this platform, using a single acceptor thread.");
+        return false;
+#endif
     }
 
     template <typename SocketType>
@@ -118,6 +189,31 @@ namespace MaNGOS
         if (m_acceptor.is_open())
             BeginAccept();
     }
+
+    template <typename SocketType>
+    void Listener<SocketType>::BeginShardAccept(size_t shard)
+    {
+        // runs on the network thread of the shard, the accepted socket stays there
+        auto socket = m_workerThreads[shard]->CreateSocket();
+
+        m_shardAcceptors[shard]->async_accept(socket->GetAsioSocket(),
+            [this, shard, socket] (const boost::system::error_code &ec)
+        {
+            this->OnShardAccept(shard, socket, ec);
+        });
+    }
+
+    template <typename SocketType>
+    void Listener<SocketType>::OnShardAccept(size_t shard, std::shared_ptr<SocketType> const& socket, const boost::system::error_code &ec)
+    {
+        if (ec)
+            m_workerThreads[shard]->RemoveSocket(socket.get());
+        else
+            socket->Open();
+
+        if (m_shardAcceptors[shard]->is_open())
+            BeginShardAccept(shard);
+    }
 }
 
 #endif /* !__LISTENER_HPP_ */
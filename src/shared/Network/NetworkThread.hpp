@@ -20,9 +20,12 @@
 #define __NETWORK_THREAD_HPP_
 
 #include "Socket.hpp"
+#include "Log/Log.h"
 
 #include <boost/asio.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <unordered_set>
@@ -33,19 +36,62 @@ namespace MaNGOS
     class NetworkThread
     {
         private:
+            // interval of the load statistics update, in milliseconds
+            static const int StatsInterval = 1000;
+
+            // bytes per second of traffic counted like one more connection in GetLoad()
+            static const uint64 TrafficPerConnection = 4096;
+
+            // event loop latency reported in the log, in milliseconds
+            static const uint32 LoopLatencyWarning = 250;
+
             boost::asio::io_context m_context;
+            boost::asio::steady_timer m_statsTimer;
 
             std::mutex m_socketLock;
             std::unordered_set<std::shared_ptr<SocketType>> m_sockets;
 
+            std::atomic<size_t> m_socketCount;
+            std::atomic<uint64> m_traffic;                  // bytes read and written by all sockets of this thread
+            std::atomic<uint64> m_trafficPerSecond;
+            std::atomic<uint32> m_loopLatency;              // how late the last stats timer ran, in milliseconds
+            uint64 m_lastTraffic;
+
             // note that the work member *must* be declared after the service member for the work constructor to function correctly
             std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_work;
 
             std::thread m_serviceThread;
 
+            void StartStatsTimer()
+            {
+                m_statsTimer.expires_after(std::chrono::milliseconds(StatsInterval));
+                m_statsTimer.async_wait([this](const boost::system::error_code& ec) { if (!ec) this->UpdateStats(); });
+            }
+
+            void UpdateStats()
+            {
+                // the handler is queued behind everything the thread had to do when the timer expired
+                auto const late = std::chrono::steady_clock::now() - m_statsTimer.expiry();
+                m_loopLatency = uint32(std::chrono::duration_cast<std::chrono::milliseconds>(late).count());
+
+                if (m_loopLatency >= LoopLatencyWarning)
+                    sLog.outBasic("NetworkThread: event loop is %u ms late (%u connections, %u bytes/s)",
+                                  uint32(m_loopLatency), uint32(m_socketCount), uint32(m_trafficPerSecond));
+
+                uint64 const traffic = m_traffic;
+                m_trafficPerSecond = (traffic - m_lastTraffic) * 1000 / StatsInterval;
+                m_lastTraffic = traffic;
+
+                StartStatsTimer();
+            }
+
         public:
-            NetworkThread() : m_work(std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(boost::asio::make_work_guard(m_context))), m_serviceThread([this] { boost::system::error_code ec; this->m_context.run(); })
+            NetworkThread() : m_statsTimer(m_context), m_socketCount(0), m_traffic(0), m_trafficPerSecond(0), m_loopLatency(0), m_lastTraffic(0),
+                m_work(std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(boost::asio::make_work_guard(m_context)))
             {
+                StartStatsTimer();
+
+                m_serviceThread = std::thread([this] { boost::system::error_code ec; this->m_context.run(); });
             }
 
             ~NetworkThread()
@@ -66,14 +112,22 @@ namespace MaNGOS
                     m_serviceThread.join();
             }
 
-            size_t Size() const { return m_sockets.size(); }
+            boost::asio::io_context& GetContext() { return m_context; }
+
+            size_t Size() const { return m_socketCount; }
+            uint64 GetTrafficPerSecond() const { return m_trafficPerSecond; }
+            uint32 GetLoopLatency() const { return m_loopLatency; }
+
+            // connections plus traffic weighted like connections, used to spread new connections over the threads
+            uint64 GetLoad() const { return Size() + m_trafficPerSecond / TrafficPerConnection; }
 
             std::shared_ptr<SocketType> CreateSocket();
 
             void RemoveSocket(Socket *socket)
             {
                 std::lock_guard<std::mutex> guard(m_socketLock);
-                m_sockets.erase(socket->shared<SocketType>());
+                if (m_sockets.erase(socket->shared<SocketType>()))
+                    --m_socketCount;
             }
     };
 
@@ -86,6 +140,9 @@ namespace MaNGOS
 
         MANGOS_ASSERT(i.second);
 
+        (*i.first)->SetTrafficCounter(&m_traffic);
+        ++m_socketCount;
+
         return *i.first;
     }
 }
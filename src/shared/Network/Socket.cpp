@@ -33,8 +33,8 @@
 namespace MaNGOS
 {
     Socket::Socket(boost::asio::io_context& context, std::function<void (Socket*)> closeHandler)
-        : m_writeState(WriteState::Idle), m_readState(ReadState::Idle), m_socket(context),
-          m_closeHandler(std::move(closeHandler)), m_outBufferFlushTimer(context), m_address("0.0.0.0"),
+        : m_writeState(WriteState::Idle), m_readState(ReadState::Idle), m_processingDeferred(false), m_socket(context),
+          m_closeHandler(std::move(closeHandler)), m_trafficCounter(nullptr), m_outBufferFlushTimer(context), m_address("0.0.0.0"),
           m_remoteAddress(boost::asio::ip::address()), m_remotePort(0){}
 
     bool Socket::Open()
@@ -107,6 +107,9 @@ namespace MaNGOS
 
         m_inBuffer->m_writePosition += length;
 
+        if (m_trafficCounter)
+            *m_trafficCounter += length;
+
         const size_t available = m_socket.available();
 
         // if there is still data to read, increase the buffer size and do so (if necessary)
@@ -117,6 +120,11 @@ namespace MaNGOS
             return;
         }
 
+        ProcessInBuffer();
+    }
+
+    void Socket::ProcessInBuffer()
+    {
         // we must repeat this in case we have read in multiple messages from the client
         while (m_inBuffer->m_readPosition < m_inBuffer->m_writePosition)
         {
@@ -140,6 +148,10 @@ namespace MaNGOS
 
                 return;
             }
+
+            // the rest of the buffer is processed when the deferred work is done
+            if (m_processingDeferred)
+                return;
         }
 
         // at this point, the packet has been read and successfully processed.  reset the buffer.
@@ -148,6 +160,40 @@ namespace MaNGOS
         StartAsyncRead();
     }
 
+    void Socket::ProcessDeferred(boost::asio::io_context& workers, std::function<bool()> work)
+    {
+        SuspendProcessing();
+
+        std::shared_ptr<Socket> ptr = shared<Socket>();
+        boost::asio::post(workers, [ptr, work = std::move(work)]() { ptr->ResumeProcessing(work()); });
+    }
+
+    void Socket::ResumeProcessing(bool result)
+    {
+        // continue on the network thread of this socket
+        std::shared_ptr<Socket> ptr = shared<Socket>();
+        boost::asio::post(m_socket.get_executor(), [ptr, result]() { ptr->OnDeferredComplete(result); });
+    }
+
+    void Socket::OnDeferredComplete(bool result)
+    {
+        m_processingDeferred = false;
+
+        if (IsClosed())
+        {
+            m_readState = ReadState::Idle;
+            return;
+        }
+
+        if (!result)
+        {
+            Close();
+            return;
+        }
+
+        ProcessInBuffer();
+    }
+
     void Socket::OnError(const boost::system::error_code& error)
     {
         // skip logging this code because it happens whenever anyone disconnects.  reduces spam.
@@ -170,35 +216,51 @@ namespace MaNGOS
 
     void Socket::Write(const char* header, int headerSize, const char* content, int contentSize)
     {
-        std::lock_guard<std::mutex> guard(m_mutex);
+        size_t unsent;
 
-        // get the correct buffer depending on the current writing state
-        PacketBuffer* outBuffer = m_writeState == WriteState::Sending ? m_secondaryOutBuffer.get() : m_outBuffer.get();
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
 
-        // write the header
-        outBuffer->Write(header, headerSize);
+            // closed (e.g. by an earlier overflow of the out buffer), nothing will be sent anymore
+            if (IsClosed())
+                return;
 
-        // write the content
-        outBuffer->Write(content, contentSize);
+            // get the correct buffer depending on the current writing state
+            PacketBuffer* outBuffer = m_writeState == WriteState::Sending ? m_secondaryOutBuffer.get() : m_outBuffer.get();
 
-        // flush data if need
-        if (m_writeState == WriteState::Idle)
-            StartWriteFlushTimer();
-    }
+            // write the header
+            outBuffer->Write(header, headerSize);
 
-    void Socket::Write(const char* buffer, int length)
-    {
-        std::lock_guard<std::mutex> guard(m_mutex);
+            // write the content
+            if (contentSize > 0)
+                outBuffer->Write(content, contentSize);
 
-        // get the correct buffer depending on the current writing state
-        PacketBuffer* outBuffer = m_writeState == WriteState::Sending ? m_secondaryOutBuffer.get() : m_outBuffer.get();
+            unsent = m_outBuffer->m_writePosition + m_secondaryOutBuffer->m_writePosition;
+
+            if (unsent <= OutBufferLimit)
+            {
+                // flush data if need
+                if (m_writeState == WriteState::Idle)
+                    StartWriteFlushTimer();
 
-        // write the header
-        outBuffer->Write(buffer, length);
+                // enough data for a full send, do not wait for more
+                if (m_writeState == WriteState::Buffering && m_outBuffer->m_writePosition >= FlushThreshold)
+                    m_outBufferFlushTimer.cancel();
+
+                return;
+            }
+        }
+
+        // the client does not read what we send, do not buffer for it without limit
+        sLog.outError("Socket::Write: %s has %u bytes of unsent data (limit %u), closing connection.",
+                      m_remoteEndpoint.c_str(), uint32(unsent), uint32(OutBufferLimit));
+
+        Close();
+    }
 
-        // flush data if need
-        if (m_writeState == WriteState::Idle)
-            StartWriteFlushTimer();
+    void Socket::Write(const char* buffer, int length)
+    {
+        Write(buffer, length, nullptr, 0);
     }
 
 // note that this function assumes that the socket mutex is locked
@@ -237,9 +299,16 @@ namespace MaNGOS
         // at this point we are guarunteed that there is data to send in the primary buffer.  send it.
         m_writeState = WriteState::Sending;
 
+        StartAsyncWrite();
+    }
+
+// note that this function assumes that the socket mutex is locked
+    void Socket::StartAsyncWrite()
+    {
+        // async_write completes only when the whole buffer is sent, so the buffer never has to be compacted
         std::shared_ptr<Socket> ptr = shared<Socket>();
-        m_socket.async_write_some(boost::asio::buffer(m_outBuffer->m_buffer, m_outBuffer->m_writePosition),
-                                  make_custom_alloc_handler(m_allocator,
+        boost::asio::async_write(m_socket, boost::asio::buffer(m_outBuffer->m_buffer.data(), m_outBuffer->m_writePosition),
+                                 make_custom_alloc_handler(m_allocator,
         [ptr](const boost::system::error_code & error, size_t length) { ptr->OnWriteComplete(error, length); }));
     }
 
@@ -270,37 +339,19 @@ namespace MaNGOS
         std::lock_guard<std::mutex> guard(m_mutex);
 
         assert(m_writeState == WriteState::Sending);
-        assert(length <= m_outBuffer->m_writePosition);
+        assert(length == m_outBuffer->m_writePosition);
 
-        // if there is data left to write, move it to the start of the buffer
-        if (length < m_outBuffer->m_writePosition)
-        {
-            memcpy(&(m_outBuffer->m_buffer[0]), &(m_outBuffer->m_buffer[length]), (m_outBuffer->m_writePosition - length) * sizeof(m_outBuffer->m_buffer[0]));
-            m_outBuffer->m_writePosition -= length;
-        }
-        // if not, reset the write pointer
-        else
-            m_outBuffer->m_writePosition = 0;
+        if (m_trafficCounter)
+            *m_trafficCounter += length;
 
-        // if there is data in the secondary buffer, append it to the primary buffer
+        m_outBuffer->m_writePosition = 0;
+
+        // if data was written meanwhile, it is in the secondary buffer.  swap the buffers and send it immediately
         if (m_secondaryOutBuffer->m_writePosition > 0)
         {
-            // do we have enough space? if not, resize
-            if (m_outBuffer->m_buffer.size() < (m_outBuffer->m_writePosition + m_secondaryOutBuffer->m_writePosition))
-                m_outBuffer->m_buffer.resize(m_outBuffer->m_writePosition + m_secondaryOutBuffer->m_writePosition);
-
-            memcpy(&(m_outBuffer->m_buffer[m_outBuffer->m_writePosition]), &(m_secondaryOutBuffer->m_buffer[0]), (m_secondaryOutBuffer->m_writePosition) * sizeof(m_secondaryOutBuffer->m_buffer[0]));
-
-            m_outBuffer->m_writePosition += m_secondaryOutBuffer->m_writePosition;
-            m_secondaryOutBuffer->m_writePosition = 0;
+            std::swap(m_outBuffer, m_secondaryOutBuffer);
+            StartAsyncWrite();
         }
-
-        std::shared_ptr<Socket> ptr = shared<Socket>();
-        // if there is any data to write, do so immediately
-        if (m_outBuffer->m_writePosition > 0)
-            m_socket.async_write_some(boost::asio::buffer(m_outBuffer->m_buffer, m_outBuffer->m_writePosition),
-                                      make_custom_alloc_handler(m_allocator,
-            [ptr](const boost::system::error_code & error, size_t length) { ptr->OnWriteComplete(error, length);}));
         else
             m_writeState = WriteState::Idle;
     }
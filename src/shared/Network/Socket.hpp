@@ -25,6 +25,7 @@
 
 #include <boost/asio.hpp>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <mutex>
@@ -39,6 +40,12 @@ namespace MaNGOS
             // ingame but increase bandwidth efficiency by reducing tcp overhead.
             static const int BufferTimeout = 50;
 
+            // buffered bytes at which the output is sent without waiting for the buffer timeout
+            static const size_t FlushThreshold = 16 * 1024;
+
+            // unsent bytes at which the client is considered stalled and disconnected
+            static const size_t OutBufferLimit = 4 * 1024 * 1024;
+
             enum class WriteState
             {
                 Idle,       // no write operation is currently underway
@@ -55,6 +62,9 @@ namespace MaNGOS
             WriteState m_writeState;
             ReadState m_readState;
 
+            // set while deferred work runs, incoming data is not processed until it is done
+            bool m_processingDeferred;
+
             boost::asio::ip::tcp::socket m_socket;
 
             std::function<void(Socket *)> m_closeHandler;
@@ -65,12 +75,18 @@ namespace MaNGOS
 
             std::mutex m_mutex;
             std::mutex m_closeMutex;
+
+            // bytes read and written, summed up per network thread for its load estimate
+            std::atomic<uint64>* m_trafficCounter;
             boost::asio::deadline_timer m_outBufferFlushTimer;
 
             void StartAsyncRead();
             void OnRead(const boost::system::error_code &error, size_t length);
+            void ProcessInBuffer();
+            void OnDeferredComplete(bool result);
 
             void StartWriteFlushTimer();
+            void StartAsyncWrite();
             void OnWriteComplete(const boost::system::error_code &error, size_t length);
             void FlushOut();
 
@@ -90,6 +106,17 @@ namespace MaNGOS
 
             void ForceFlushOut();
 
+            // Run work (blocking database queries, expensive crypto) on the given worker context instead of the network thread.
+            // Incoming data is not processed until the work is done, its result is handled like a ProcessIncomingData() result.
+            // The work may read from the input buffer, nothing else touches it meanwhile.
+            void ProcessDeferred(boost::asio::io_context& workers, std::function<bool()> work);
+            bool IsProcessingDeferred() const { return m_processingDeferred; }
+
+            // Same as ProcessDeferred() for work finished elsewhere: suspend in ProcessIncomingData(), then resume
+            // exactly once from any thread with the result of the work.
+            void SuspendProcessing() { m_processingDeferred = true; }
+            void ResumeProcessing(bool result);
+
         public:
             Socket(boost::asio::io_context &context, std::function<void (Socket *)> closeHandler);
             virtual ~Socket() = default;
@@ -114,6 +141,8 @@ namespace MaNGOS
             template <typename T>
             std::shared_ptr<T> shared() { return std::static_pointer_cast<T>(shared_from_this()); }
 
+            void SetTrafficCounter(std::atomic<uint64>* counter) { m_trafficCounter = counter; }
+
             boost::asio::ip::address GetRemoteIpAddress() const { return m_remoteAddress; }
             uint16 GetRemotePort() const { return m_remotePort; }
 
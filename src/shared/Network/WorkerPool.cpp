@@ -0,0 +1,55 @@
+/*
+* This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#include "WorkerPool.hpp"
+
+namespace MaNGOS
+{
+    WorkerPool::WorkerPool(int threads, std::function<void()> const& threadStart, std::function<void()> const& threadEnd)
+        : m_work(std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(boost::asio::make_work_guard(m_context)))
+    {
+        if (threads < 1)
+            threads = 1;
+
+        m_threads.reserve(threads);
+        for (int i = 0; i < threads; ++i)
+        {
+            m_threads.emplace_back([this, threadStart, threadEnd]()
+            {
+                if (threadStart)
+                    threadStart();
+
+                m_context.run();
+
+                if (threadEnd)
+                    threadEnd();
+            });
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        // let run() return once the queue is drained
+        m_work.reset();
+
+        for (auto& thread : m_threads)
+            if (thread.joinable())
+                thread.join();
+    }
+}
@@ -0,0 +1,54 @@
+/*
+* This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+
+#ifndef __WORKER_POOL_HPP_
+#define __WORKER_POOL_HPP_
+
+#include <boost/asio.hpp>
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace MaNGOS
+{
+    // Runs posted work on a fixed set of threads, used to keep blocking work (database queries, crypto) off the network threads
+    class WorkerPool
+    {
+        private:
+            boost::asio::io_context m_context;
+
+            // note that the work member *must* be declared after the service member for the work constructor to function correctly
+            std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_work;
+
+            std::vector<std::thread> m_threads;
+
+        public:
+            // threadStart and threadEnd are called in every worker thread, e.g. to set up database thread resources
+            WorkerPool(int threads, std::function<void()> const& threadStart = nullptr, std::function<void()> const& threadEnd = nullptr);
+
+            // finishes already queued work before returning
+            ~WorkerPool();
+
+            boost::asio::io_context& GetContext() { return m_context; }
+    };
+}
+
+#endif /* !__WORKER_POOL_HPP_ */
@@ -18,6 +18,81 @@
 
 #include "Util/ByteBuffer.h"
 
+namespace
+{
+    // capacity of the size classes, a recycled vector has at least the capacity of its class
+    size_t const BufferClassSize[] = { 64, 256, 1024, 4096, 16384, 65536 };
+    // recycled vectors kept per class and thread
+    size_t const BufferClassLimit[] = { 128, 128, 64, 32, 16, 8 };
+
+    size_t const BufferClassCount = sizeof(BufferClassSize) / sizeof(BufferClassSize[0]);
+
+    // larger vectors are freed, they would pin memory for rare huge packets
+    size_t const BufferMaxRecycledCapacity = 4 * BufferClassSize[BufferClassCount - 1];
+
+    struct ThreadBufferPool
+    {
+        std::vector<std::vector<uint8>> free[BufferClassCount];
+
+        ~ThreadBufferPool();
+    };
+
+    // buffers destroyed after the pool at thread exit are not recycled
+    thread_local bool t_bufferPoolDestroyed = false;
+    thread_local ThreadBufferPool t_bufferPool;
+
+    ThreadBufferPool::~ThreadBufferPool()
+    {
+        t_bufferPoolDestroyed = true;
+    }
+}
+
+void ByteBufferPool::Acquire(std::vector<uint8>& storage, size_t res)
+{
+    if (!res)
+        return;
+
+    if (res > BufferClassSize[BufferClassCount - 1] || t_bufferPoolDestroyed)
+    {
+        storage.reserve(res);
+        return;
+    }
+
+    size_t index = 0;
+    while (BufferClassSize[index] < res)
+        ++index;
+
+    std::vector<std::vector<uint8>>& free = t_bufferPool.free[index];
+    if (free.empty())
+    {
+        // reserve only what was asked for, Release() files the vector under the class its capacity reaches
+        storage.reserve(res);
+        return;
+    }
+
+    storage.swap(free.back());
+    free.pop_back();
+}
+
+void ByteBufferPool::Release(std::vector<uint8>& storage)
+{
+    size_t const capacity = storage.capacity();
+    if (capacity < BufferClassSize[0] || capacity > BufferMaxRecycledCapacity || t_bufferPoolDestroyed)
+        return;
+
+    size_t index = BufferClassCount - 1;
+    while (BufferClassSize[index] > capacity)
+        --index;
+
+    std::vector<std::vector<uint8>>& free = t_bufferPool.free[index];
+    if (free.size() >= BufferClassLimit[index])
+        return;
+
+    storage.clear();
+    free.emplace_back();
+    free.back().swap(storage);
+}
+
 void BitStream::Clear()
 {
     _data.clear();
@@ -123,6 +123,18 @@ struct Unused
     Unused() {}
 };
 
+// Per thread recycling of ByteBuffer storage, sorted in size classes by capacity.
+// Packets are short lived and created at high rates, so a destroyed buffer gives its
+// storage to the next buffer of the same size class created on that thread.
+class ByteBufferPool
+{
+    public:
+        // give storage an empty vector with at least res bytes capacity
+        static void Acquire(std::vector<uint8>& storage, size_t res);
+        // take over the capacity of storage for later buffers, storage is left empty
+        static void Release(std::vector<uint8>& storage);
+};
+
 class ByteBuffer
 {
     public:
@@ -131,19 +143,26 @@ class ByteBuffer
         // constructor
         ByteBuffer(): _rpos(0), _wpos(0), _bitpos(8), _curbitval(0)
         {
-            _storage.reserve(DEFAULT_SIZE);
+            ByteBufferPool::Acquire(_storage, DEFAULT_SIZE);
         }
 
         // constructor
         ByteBuffer(size_t res): _rpos(0), _wpos(0), _bitpos(8), _curbitval(0)
         {
-            _storage.reserve(res);
+            ByteBufferPool::Acquire(_storage, res);
         }
 
         // copy constructor
         ByteBuffer(const ByteBuffer &buf) : _rpos(buf._rpos), _wpos(buf._wpos),
-            _storage(buf._storage), _bitpos(buf._bitpos), _curbitval(buf._curbitval)
+            _bitpos(buf._bitpos), _curbitval(buf._curbitval)
+        {
+            ByteBufferPool::Acquire(_storage, buf._storage.size());
+            _storage.assign(buf._storage.begin(), buf._storage.end());
+        }
+
+        ~ByteBuffer()
         {
+            ByteBufferPool::Release(_storage);
         }
 
         void clear()
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OBJECT_POOL_H
+#define MANGOS_OBJECT_POOL_H
+
+#include "Common.h"
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Slab allocator for world objects that are created and destroyed in large numbers
+// (grid load and unload). Memory is requested in slabs of SLAB_OBJECTS objects and kept,
+// freed objects go to a free list and are handed out again to the next allocation,
+// so the heap does not fragment over time.
+// Only allocations of exactly sizeof(T) are pooled, classes derived from T inherit the
+// class allocation operators but fall back to the global heap.
+template<class T>
+class ObjectPool
+{
+    public:
+        static const size_t SLAB_OBJECTS = 64;
+
+        static void* Allocate(size_t size)
+        {
+            if (size != sizeof(T))
+                return ::operator new(size);
+
+            Pool& pool = GetPool();
+            std::lock_guard<std::mutex> guard(pool.lock);
+            if (!pool.freeList)
+                pool.Grow();
+
+            Slot* slot = pool.freeList;
+            pool.freeList = slot->next;
+            ++pool.used;
+            return slot;
+        }
+
+        static void Deallocate(void* ptr, size_t size)
+        {
+            if (!ptr)
+                return;
+
+            if (size != sizeof(T))
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            Pool& pool = GetPool();
+            std::lock_guard<std::mutex> guard(pool.lock);
+            Slot* slot = static_cast<Slot*>(ptr);
+            slot->next = pool.freeList;
+            pool.freeList = slot;
+            --pool.used;
+        }
+
+        // objects currently allocated from the pool and objects the reserved slabs can hold
+        static void GetStats(size_t& used, size_t& reserved)
+        {
+            Pool& pool = GetPool();
+            std::lock_guard<std::mutex> guard(pool.lock);
+            used = pool.used;
+            reserved = pool.slabs.size() * SLAB_OBJECTS;
+        }
+
+    private:
+        union Slot
+        {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        struct Pool
+        {
+            Pool() : freeList(nullptr), used(0) {}
+
+            void Grow()
+            {
+                Slot* slab = new Slot[SLAB_OBJECTS];
+                slabs.emplace_back(slab);
+                for (size_t i = SLAB_OBJECTS; i > 0; --i)
+                {
+                    slab[i - 1].next = freeList;
+                    freeList = &slab[i - 1];
+                }
+            }
+
+            std::mutex lock;
+            std::vector<std::unique_ptr<Slot[]>> slabs;
+            Slot* freeList;
+            size_t used;
+        };
+
+        // never destroyed: pooled objects may still be freed during static destruction
+        static Pool& GetPool()
+        {
+            static Pool* pool = new Pool;
+            return *pool;
+        }
+};
+
+#endif
@@ -1,6 +1,6 @@
 #ifndef __REVISION_SQL_H__
 #define __REVISION_SQL_H__
  #define REVISION_DB_REALMD "required_c0001_01_realmd_account_drop_sha"
- #define REVISION_DB_CHARACTERS "required_c0001_01_characters_account_instances_entered"
- #define REVISION_DB_MANGOS "required_c0003_02_mangos_quest_data"
+ #define REVISION_DB_CHARACTERS "required_c0001_02_characters_update_fields_blob"
+ #define REVISION_DB_MANGOS "required_c0004_04_mangos_command"
 #endif // __REVISION_SQL_H__